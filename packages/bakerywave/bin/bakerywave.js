@@ -2,6 +2,7 @@
 const fs = require("fs");
 const path = require("path");
 const { spawn, spawnSync } = require("child_process");
+const { buildDocgenArgs } = require("../src/docgen-args");
 const toml = requireToml();
 
 function requireToml() {
@@ -609,6 +610,41 @@ function resolveReferenceDefaults(baseCwd, siteDirAbs, referenceOptions) {
         srcDir,
         typesDir,
         input,
+        schemaVersion: referenceOptions.schemaVersion === 2 ? 2 : 1,
+        limits: resolveDocgenLimits(referenceOptions),
+        // 사이트가 정적 파일로 내려받는 검색 인덱스. 사이트 디렉터리 기준 경로다.
+        searchIndex: referenceOptions.searchIndex ? path.resolve(siteDirAbs, referenceOptions.searchIndex) : null,
+    };
+}
+
+// luau-docgen의 모듈별 검사 예산. 양수만 넘기고 나머지는 luau-docgen 기본값을 쓴다.
+function resolveDocgenLimits(referenceOptions) {
+    const limits = {};
+    for (const key of ["moduleTimeLimitSec", "instantiationLimit", "unifierIterationLimit"]) {
+        const value = referenceOptions[key];
+        if (typeof value === "number" && value > 0) {
+            limits[key] = value;
+        }
+    }
+    return limits;
+}
+
+// renderer = "native"이면 generate.js와 같은 정규화 결과로 luau-docgen이 MDX를 직접 쓰게 한다.
+function resolveNativeRender(generator, siteDirAbs, referenceOptions, defaults) {
+    if (referenceOptions.renderer !== "native" || typeof generator.buildNativeRenderOptions !== "function") {
+        return null;
+    }
+    const options = generator.normalizeOptions(siteDirAbs, {
+        ...referenceOptions,
+        lang: defaults.lang,
+        input: defaults.input,
+    });
+    if (options.renderMode !== "mdx") {
+        return null;
+    }
+    return {
+        outDir: options.outDir,
+        optionsJson: JSON.stringify(generator.buildNativeRenderOptions(options)),
     };
 }
 
@@ -618,14 +654,7 @@ function runLuauDocgen(docgenScript, defaults, docgenFlags) {
     const binaryPath = path.join(path.dirname(process.execPath), binaryName);
 
     if (fs.existsSync(binaryPath)) {
-        const args = ["--root", defaults.rootDir, "--src", defaults.srcDir, "--out", defaults.input];
-
-        if (defaults.typesDir) {
-            args.push("--types", defaults.typesDir);
-        }
-        if (docgenFlags.failOnWarning) {
-            args.push("--fail-on-warning");
-        }
+        const args = buildDocgenArgs(defaults, { ...docgenFlags, legacy: false });
 
         // Native binary doesn't support --legacy flag as it IS the native implementation
         // pass generator version if needed, but we might not have pkg version here easily if we are outside.
@@ -653,25 +682,7 @@ function runLuauDocgen(docgenScript, defaults, docgenFlags) {
         process.exit(1);
     }
 
-    const args = [
-        docgenScript,
-        "--root",
-        defaults.rootDir,
-        "--src",
-        defaults.srcDir,
-        "--out",
-        defaults.input,
-    ];
-
-    if (defaults.typesDir) {
-        args.push("--types", defaults.typesDir);
-    }
-    if (docgenFlags.failOnWarning) {
-        args.push("--fail-on-warning");
-    }
-    if (docgenFlags.legacy) {
-        args.push("--legacy");
-    }
+    const args = [docgenScript, ...buildDocgenArgs(defaults, docgenFlags)];
 
     const result = spawnSync(process.execPath, args, {
         stdio: "inherit",
@@ -691,13 +702,94 @@ function runLuauDocgen(docgenScript, defaults, docgenFlags) {
     }
 }
 
-function runReferenceBuild(docgenScript, generator, baseCwd, siteDirAbs, referenceOptions, docgenFlags, configPath) {
+const DOCGEN_SOURCE_EXTS = new Set([".luau", ".lua"]);
+
+// luau-docgen Node-API 애드온이 빌드되어 있으면 프로세스를 띄우지 않고 세션으로 생성한다.
+function createInProcessDocgen(docgenScript, defaults, docgenFlags) {
+    if (docgenFlags.legacy) {
+        return null;
+    }
+
+    const addonModulePath = path.resolve(path.dirname(docgenScript), "..", "src", "native-addon.js");
+    if (!fs.existsSync(addonModulePath)) {
+        return null;
+    }
+
+    try {
+        const addonModule = require(addonModulePath);
+        return addonModule.createNativeSession({
+            rootDir: defaults.rootDir,
+            srcDir: defaults.srcDir,
+            typesDir: defaults.typesDir,
+            failOnWarning: docgenFlags.failOnWarning,
+            classLayout: true,
+            renderDir: defaults.render ? defaults.render.outDir : undefined,
+            renderOptions: defaults.render ? defaults.render.optionsJson : undefined,
+            searchIndexPath: defaults.searchIndex || undefined,
+            schemaVersion: defaults.schemaVersion,
+            ...defaults.limits,
+        });
+    } catch (error) {
+        console.warn(`[bakerywave] luau-docgen addon unavailable: ${error.message}`);
+        return null;
+    }
+}
+
+// 세션에 반영하지 못한 변경이 있으면 세션 내용이 디스크와 달라지므로, watch 모드는 세션을 새로 만든다.
+function runInProcessDocgen(session, defaults, changedFiles) {
+    for (const filePath of changedFiles) {
+        const exists = fs.existsSync(filePath);
+        const status = exists ? session.updateFile(filePath, fs.readFileSync(filePath)) : session.removeFile(filePath);
+        if (status !== 0) {
+            const error = new Error(`failed to ${exists ? "update" : "remove"} ${filePath} in the luau-docgen session`);
+            error.resetSession = true;
+            throw error;
+        }
+    }
+
+    const result = session.generate();
+    if (result.status !== 0) {
+        const error = new Error(`luau-docgen finished with status ${result.status}`);
+        error.status = result.status;
+        throw error;
+    }
+
+    // 결과는 메모리로 generate.js에 넘기므로 입력 JSON을 쓰지 않는다.
+    // 이전 실행이 남긴 JSON이 있으면 Docusaurus 플러그인(loadContent)이 그 내용으로 페이지를 다시 만들므로 지운다.
+    fs.rmSync(path.resolve(defaults.rootDir, defaults.input), { force: true });
+
+    return { data: result.data, raw: result.raw };
+}
+
+function runReferenceBuild(docgenScript, generator, baseCwd, siteDirAbs, referenceOptions, docgenFlags, configPath, docgenState = null) {
     if (referenceOptions.enabled === false) {
         console.log("[bakerywave] reference disabled.");
         return;
     }
     const defaults = resolveReferenceDefaults(baseCwd, siteDirAbs, referenceOptions);
-    runLuauDocgen(docgenScript, defaults, docgenFlags);
+    defaults.render = resolveNativeRender(generator, siteDirAbs, referenceOptions, defaults);
+
+    let content = null;
+    const session = docgenState ? docgenState.session : createInProcessDocgen(docgenScript, defaults, docgenFlags);
+    if (session) {
+        try {
+            content = runInProcessDocgen(session, defaults, docgenState ? docgenState.changedFiles : []);
+        } catch (error) {
+            console.error(`[bakerywave] ${error.message}`);
+            // watch 모드는 이전 결과를 두고 다음 변경을 기다린다.
+            if (!docgenState) {
+                process.exit(error.status || 1);
+            }
+            docgenState.resetSession = error.resetSession === true;
+            return;
+        } finally {
+            if (!docgenState) {
+                session.close();
+            }
+        }
+    } else {
+        runLuauDocgen(docgenScript, defaults, docgenFlags);
+    }
 
     const generatorOptions = {
         ...referenceOptions,
@@ -705,7 +797,7 @@ function runReferenceBuild(docgenScript, generator, baseCwd, siteDirAbs, referen
         input: defaults.input,
     };
 
-    const result = generator.generateReferenceDocs(siteDirAbs, generatorOptions);
+    const result = generator.generateReferenceDocs(siteDirAbs, generatorOptions, content);
     if (result.skipped) {
         console.error("[bakerywave] reference generation skipped.");
         process.exit(1);
@@ -779,12 +871,15 @@ function createWatchers(targets, onChange) {
         if (!fs.existsSync(target)) {
             continue;
         }
+        const listener = (eventType, filename) => {
+            onChange(filename ? path.join(target, filename.toString()) : null);
+        };
         try {
-            const watcher = fs.watch(target, { recursive: true }, onChange);
+            const watcher = fs.watch(target, { recursive: true }, listener);
             watchers.push(watcher);
             continue;
         } catch (error) {
-            const watcher = fs.watch(target, onChange);
+            const watcher = fs.watch(target, listener);
             watchers.push(watcher);
         }
     }
@@ -797,6 +892,7 @@ function runReferenceWatch(docgenScript, generator, baseCwd, siteDirAbs, referen
         return;
     }
     const defaults = resolveReferenceDefaults(baseCwd, siteDirAbs, referenceOptions);
+    defaults.render = resolveNativeRender(generator, siteDirAbs, referenceOptions, defaults);
     const watchTargets = [path.join(defaults.rootDir, defaults.srcDir)];
     if (defaults.typesDir) {
         watchTargets.push(path.join(defaults.rootDir, defaults.typesDir));
@@ -805,6 +901,12 @@ function runReferenceWatch(docgenScript, generator, baseCwd, siteDirAbs, referen
     let running = false;
     let pending = false;
 
+    // 애드온 세션은 watch 동안 유지하고, 바뀐 소스 파일만 세션에 반영한다.
+    let session = null;
+    let sessionCreated = false;
+    let resetSession = false;
+    const changedFiles = new Set();
+
     const trigger = () => {
         if (running) {
             pending = true;
@@ -813,7 +915,25 @@ function runReferenceWatch(docgenScript, generator, baseCwd, siteDirAbs, referen
         running = true;
         pending = false;
         try {
-            runReferenceBuild(docgenScript, generator, baseCwd, siteDirAbs, referenceOptions, docgenFlags, configPath);
+            if (resetSession && session) {
+                session.close();
+                session = null;
+                sessionCreated = false;
+            }
+            resetSession = false;
+
+            if (!sessionCreated) {
+                session = createInProcessDocgen(docgenScript, defaults, docgenFlags);
+                sessionCreated = true;
+                changedFiles.clear();
+            }
+
+            const docgenState = session ? { session, changedFiles: Array.from(changedFiles) } : null;
+            changedFiles.clear();
+            runReferenceBuild(docgenScript, generator, baseCwd, siteDirAbs, referenceOptions, docgenFlags, configPath, docgenState);
+            if (docgenState && docgenState.resetSession) {
+                resetSession = true;
+            }
         } finally {
             running = false;
             if (pending) {
@@ -824,7 +944,12 @@ function runReferenceWatch(docgenScript, generator, baseCwd, siteDirAbs, referen
 
     trigger();
 
-    const watchers = createWatchers(watchTargets, () => {
+    const watchers = createWatchers(watchTargets, (changedPath) => {
+        if (changedPath && DOCGEN_SOURCE_EXTS.has(path.extname(changedPath))) {
+            changedFiles.add(changedPath);
+        } else {
+            resetSession = true;
+        }
         trigger();
     });
 
@@ -0,0 +1,54 @@
+const fs = require("fs");
+const path = require("path");
+
+function pushDocgenLimitArgs(args, limits) {
+    if (limits.moduleTimeLimitSec) {
+        args.push("--module-time-limit", String(limits.moduleTimeLimitSec));
+    }
+    if (limits.instantiationLimit) {
+        args.push("--instantiation-limit", String(limits.instantiationLimit));
+    }
+    if (limits.unifierIterationLimit) {
+        args.push("--unifier-limit", String(limits.unifierIterationLimit));
+    }
+}
+
+function writeRenderOptionsFile(defaults) {
+    const inputPath = path.resolve(defaults.rootDir, defaults.input);
+    const optionsPath = path.join(path.dirname(inputPath), `${defaults.lang}.render.json`);
+    fs.mkdirSync(path.dirname(optionsPath), { recursive: true });
+    fs.writeFileSync(optionsPath, defaults.render.optionsJson, "utf8");
+    return optionsPath;
+}
+
+// luau-docgen 실행 인자. 네이티브 바이너리를 바로 실행할 때와 luau-docgen.js를 거칠 때 같은 인자를 쓴다.
+// --legacy는 JS 구현으로 돌리므로 네이티브 전용 옵션을 붙이지 않는다.
+function buildDocgenArgs(defaults, docgenFlags) {
+    const args = ["--root", defaults.rootDir, "--src", defaults.srcDir, "--out", defaults.input, "--class-layout"];
+
+    if (defaults.typesDir) {
+        args.push("--types", defaults.typesDir);
+    }
+    if (docgenFlags.failOnWarning) {
+        args.push("--fail-on-warning");
+    }
+    if (docgenFlags.legacy) {
+        args.push("--legacy");
+        return args;
+    }
+    if (defaults.render) {
+        args.push("--render-mdx", defaults.render.outDir, "--render-options", writeRenderOptionsFile(defaults));
+    }
+    if (defaults.searchIndex) {
+        args.push("--search-index", defaults.searchIndex);
+    }
+    if (defaults.schemaVersion === 2) {
+        args.push("--schema-version", "2");
+    }
+    pushDocgenLimitArgs(args, defaults.limits);
+    return args;
+}
+
+module.exports = {
+    buildDocgenArgs,
+};
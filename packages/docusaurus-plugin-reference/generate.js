@@ -256,6 +256,7 @@ function normalizeOptions(siteDir, opts) {
     manifestPath,
     routeBasePath,
     renderMode: opts.renderMode || "mdx",
+    renderer: opts.renderer === "native" ? "native" : "js",
     clean: opts.clean !== false,
     includePrivate: opts.includePrivate === true,
     overviewTitle: opts.overviewTitle || "Overview",
@@ -648,7 +649,7 @@ function renderSummarySection(classSymbol, anchorsByKind, classLinkMap, options)
   return lines;
 }
 
-function renderClassPage(classSymbol, members, options, classLinkMap) {
+function renderClassPage(classSymbol, members, options, classLinkMap, layoutSections = null) {
   const className = classSymbol.name || "Class";
   const classSourceUrl = resolveSourceUrl(classSymbol.location, options && options.source);
   const lines = [`# ${className}`];
@@ -661,22 +662,34 @@ function renderClassPage(classSymbol, members, options, classLinkMap) {
     lines.push("", body);
   }
 
-  const groups = groupSymbols(members || []);
   const usedAnchorIds = new Set();
   const anchorsByKind = new Map();
 
-  for (const kind of SECTION_ORDER) {
-    const items = groups.get(kind);
-    if (!items || items.length === 0) {
-      continue;
+  if (layoutSections) {
+    // luau-docgen --class-layout이 그룹/정렬/앵커를 미리 계산해 둔 경우 그대로 쓴다.
+    for (const section of layoutSections) {
+      for (const entry of section.entries) {
+        if (entry.anchorId) {
+          usedAnchorIds.add(entry.anchorId);
+        }
+      }
+      anchorsByKind.set(section.kind, section.entries);
     }
-    const entries = [];
-    for (const symbol of items) {
-      const headingLabel = symbol.name || symbol.qualifiedName || "Unnamed";
-      const anchorId = createAnchorId(symbol, headingLabel, usedAnchorIds);
-      entries.push({ symbol, anchorId });
+  } else {
+    const groups = groupSymbols(members || []);
+    for (const kind of SECTION_ORDER) {
+      const items = groups.get(kind);
+      if (!items || items.length === 0) {
+        continue;
+      }
+      const entries = [];
+      for (const symbol of items) {
+        const headingLabel = symbol.name || symbol.qualifiedName || "Unnamed";
+        const anchorId = createAnchorId(symbol, headingLabel, usedAnchorIds);
+        entries.push({ symbol, anchorId });
+      }
+      anchorsByKind.set(kind, entries);
     }
-    anchorsByKind.set(kind, entries);
   }
 
   const summaryLines = renderSummarySection(classSymbol, anchorsByKind, classLinkMap, options);
@@ -826,9 +839,68 @@ function renderOverviewPage(categoryMap, options) {
   return `${lines.join("\n")}\n`;
 }
 
-function buildOutputs(referenceJson, options) {
-  const outputs = [];
-  const modules = Array.isArray(referenceJson.modules) ? referenceJson.modules : [];
+function createRefResolver(modules) {
+  return (ref) => {
+    const moduleData = ref ? modules[ref.module] : null;
+    if (!moduleData || !Array.isArray(moduleData.symbols)) {
+      return null;
+    }
+    return moduleData.symbols[ref.symbol] || null;
+  };
+}
+
+// --class-layout 출력이면 페이지 순서, 경로, 섹션, 앵커가 이미 들어 있다.
+function collectLayoutClassEntries(referenceJson, modules) {
+  const classes = referenceJson.classes;
+  const order = referenceJson.classOrder;
+  if (!Array.isArray(classes) || !Array.isArray(order)) {
+    return null;
+  }
+  if (!classes.every((entry) => entry && entry.layout)) {
+    return null;
+  }
+
+  const resolveRef = createRefResolver(modules);
+  return order.map((classIndex) => {
+    const entry = classes[classIndex];
+    const layout = entry.layout;
+    const sections = layout.sections.map((section) => ({
+      kind: section.kind,
+      entries: section.members
+        .map((member) => ({ symbol: resolveRef(member), anchorId: member.anchor }))
+        .filter((item) => item.symbol),
+    }));
+    return {
+      id: entry.name,
+      relativePath: layout.path,
+      link: layout.link,
+      categories: layout.categories,
+      classSymbol: resolveRef(entry.symbol) || { name: entry.name },
+      members: null,
+      sections,
+    };
+  });
+}
+
+function collectIndexedClassMap(referenceJson, modules) {
+  const classMap = new Map();
+  const resolveRef = createRefResolver(modules);
+
+  for (const entry of referenceJson.classes) {
+    if (!entry || !entry.name || classMap.has(entry.name)) {
+      continue;
+    }
+    const members = Array.isArray(entry.members) ? entry.members.map(resolveRef).filter(Boolean) : [];
+    classMap.set(entry.name, { classSymbol: resolveRef(entry.symbol), members });
+  }
+
+  return classMap;
+}
+
+function collectClassMap(referenceJson, modules) {
+  if (Array.isArray(referenceJson.classes)) {
+    return collectIndexedClassMap(referenceJson, modules);
+  }
 
   const classMap = new Map();
 
@@ -857,6 +929,12 @@ function buildOutputs(referenceJson, options) {
     }
   }
 
+  return classMap;
+}
+
+function collectClassEntries(referenceJson, modules) {
+  const classMap = collectClassMap(referenceJson, modules);
+
   const classEntries = [];
   for (const [className, entry] of classMap.entries()) {
     const categories = getSymbolCategories(entry.classSymbol || {});
@@ -867,25 +945,34 @@ function buildOutputs(referenceJson, options) {
     classEntries.push({
       id: className,
       relativePath,
+      link: relativePath.replace(/\\/g, "/").replace(/\.mdx$/, ""),
       categories,
       classSymbol: entry.classSymbol || { name: className },
       members: entry.members,
+      sections: null,
     });
   }
 
   classEntries.sort((left, right) => left.id.localeCompare(right.id));
+  return classEntries;
+}
+
+function buildOutputs(referenceJson, options) {
+  const outputs = [];
+  const modules = Array.isArray(referenceJson.modules) ? referenceJson.modules : [];
+  const classEntries =
+    collectLayoutClassEntries(referenceJson, modules) || collectClassEntries(referenceJson, modules);
 
   const classLinkMap = new Map();
   for (const entry of classEntries) {
-    const link = entry.relativePath.replace(/\\/g, "/").replace(/\.mdx$/, "");
-    classLinkMap.set(entry.id, link);
+    classLinkMap.set(entry.id, entry.link);
   }
 
   for (const entry of classEntries) {
     outputs.push({
       id: entry.id,
       relativePath: entry.relativePath,
-      content: renderClassPage(entry.classSymbol, entry.members, options, classLinkMap),
+      content: renderClassPage(entry.classSymbol, entry.members, options, classLinkMap, entry.sections),
     });
   }
 
@@ -911,6 +998,147 @@ function buildOutputs(referenceJson, options) {
   return outputs;
 }
 
+// schemaVersion 2(luau-docgen --schema-version 2)를 기존 v1 모양으로 펼친다.
+// 문자열은 strings 배열 번호로, 심볼과 모듈은 키 없는 배열로 들어 있다.
+function expandReferenceJson(data) {
+  if (!data || data.schemaVersion !== 2) {
+    return data;
+  }
+
+  const strings = data.strings;
+  const str = (index) => strings[index];
+  const optionalStr = (index) => (index === null ? null : strings[index]);
+
+  const expandStructured = (kind, values) => {
+    if (kind === "function" || kind === "constructor") {
+      return {
+        params: values[0].map(([name, type, description]) => ({
+          name: str(name),
+          type: optionalStr(type),
+          description: optionalStr(description),
+        })),
+        returns: values[1].map(([type, description]) => ({
+          type: optionalStr(type),
+          description: optionalStr(description),
+        })),
+        errors: values[2].map(([type, description]) => ({
+          type: optionalStr(type),
+          description: optionalStr(description),
+        })),
+        yields: values[3],
+      };
+    }
+    if (kind === "property") {
+      return { type: optionalStr(values[0]), readonly: values[1] };
+    }
+    if (kind === "interface") {
+      return {
+        fields: values[0].map(([name, type, description]) => ({
+          name: str(name),
+          type: optionalStr(type),
+          description: optionalStr(description),
+        })),
+      };
+    }
+    if (kind === "type" || kind === "field") {
+      return { type: optionalStr(values[0]) };
+    }
+    if (kind === "class") {
+      return { indexName: optionalStr(values[0]) };
+    }
+    return {};
+  };
+
+  const expandSymbol = (values) => {
+    const kind = str(values[0]);
+    return {
+      kind,
+      name: str(values[1]),
+      qualifiedName: str(values[2]),
+      location: { file: str(values[3]), line: values[4], column: values[5] },
+      docs: {
+        summary: str(values[6]),
+        descriptionMarkdown: str(values[7]),
+        tags: values[8].map((tag) => {
+          const item = { name: str(tag[0]), value: typeof tag[1] === "boolean" ? tag[1] : str(tag[1]) };
+          if (tag.length > 2) {
+            item.description = str(tag[2]);
+          }
+          return item;
+        }),
+        examples: [],
+      },
+      types: { display: str(values[9]), structured: expandStructured(kind, values[10]) },
+      visibility: str(values[11]),
+    };
+  };
+
+  const expanded = {
+    ...data,
+    schemaVersion: 1,
+    modules: data.modules.map(([id, modulePath, sourceHash, symbols]) => ({
+      id: str(id),
+      path: str(modulePath),
+      sourceHash,
+      symbols: symbols.map(expandSymbol),
+    })),
+  };
+  delete expanded.strings;
+  return expanded;
+}
+
+function toOptionString(value) {
+  return typeof value === "string" ? value : "";
+}
+
+// luau-docgen --render-options로 넘길 JSON. 네이티브 렌더러가 읽는 키만 담는다.
+function buildNativeRenderOptions(options) {
+  const source = options.source && options.source.repoUrl ? options.source : null;
+  return {
+    routeBasePath: options.routeBasePath,
+    lang: options.lang,
+    overviewTitle: String(options.overviewTitle),
+    defaultCategory: String(options.defaultCategory),
+    categoryOrder: options.categoryOrder.filter((value) => typeof value === "string"),
+    source: source
+      ? {
+          repoUrl: toOptionString(source.repoUrl),
+          branch: toOptionString(source.branch),
+          basePath: toOptionString(source.basePath),
+          stripPrefix: toOptionString(source.stripPrefix),
+          icon: toOptionString(source.icon),
+        }
+      : null,
+  };
+}
+
+// 네이티브 렌더러가 같은 outDir에 같은 옵션으로 이미 페이지를 썼으면 경로 목록만 만든다.
+// 표시가 없거나 outDir, 옵션 해시가 다르면 null을 돌려 JS 렌더링으로 돌아간다.
+function collectNativeOutputs(referenceJson, options) {
+  const mdx = referenceJson.mdx;
+  if (options.renderer !== "native" || !mdx || typeof mdx.outDir !== "string") {
+    return null;
+  }
+  if (path.resolve(mdx.outDir) !== path.resolve(options.outDir)) {
+    return null;
+  }
+  if (mdx.optionsHash !== sha1(JSON.stringify(buildNativeRenderOptions(options)))) {
+    return null;
+  }
+  const modules = Array.isArray(referenceJson.modules) ? referenceJson.modules : [];
+  const classEntries = collectLayoutClassEntries(referenceJson, modules);
+  if (!classEntries) {
+    return null;
+  }
+  const outputs = classEntries.map((entry) => ({
+    id: entry.id,
+    relativePath: entry.relativePath,
+    content: null,
+  }));
+  outputs.push({ id: "index", relativePath: "index.mdx", content: null });
+  return outputs;
+}
+
 function generateReferenceDocs(siteDir, opts = {}, providedContent = null) {
   const options = normalizeOptions(siteDir, opts);
   if (options.renderMode !== "mdx") {
@@ -922,7 +1150,8 @@ function generateReferenceDocs(siteDir, opts = {}, providedContent = null) {
     return { written: [], skipped: true };
   }
 
-  const outputs = buildOutputs(content.data, options);
+  const data = expandReferenceJson(content.data);
+  const outputs = collectNativeOutputs(data, options) || buildOutputs(data, options);
   const files = outputs.map((item) => item.relativePath);
   const manifest = loadManifest(options.manifestPath);
 
@@ -931,6 +1160,9 @@ function generateReferenceDocs(siteDir, opts = {}, providedContent = null) {
   }
 
   for (const output of outputs) {
+    if (output.content === null) {
+      continue;
+    }
     writeFile(path.join(options.outDir, output.relativePath), output.content);
   }
 
@@ -940,7 +1172,7 @@ function generateReferenceDocs(siteDir, opts = {}, providedContent = null) {
   manifest.inputs[options.lang] = {
     path: options.input,
     hash: sha1(content.raw),
-    generatorVersion: content.data.generatorVersion || null,
+    generatorVersion: data.generatorVersion || null,
     generatedAt: new Date().toISOString(),
   };
   saveManifest(options.manifestPath, manifest);
@@ -988,5 +1220,9 @@ function generateReferenceDocs(siteDir, opts = {}, providedContent = null) {
 
 module.exports = {
   normalizeOptions,
+  expandReferenceJson,
+  buildNativeRenderOptions,
+  buildOutputs,
+  collectNativeOutputs,
   generateReferenceDocs,
 };
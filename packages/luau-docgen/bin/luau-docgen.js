@@ -70,6 +70,15 @@ function printHelp() {
   console.log("  --types <dir>        Optional types directory");
   console.log("  --out <path>         Output JSON path (default: reference.json)");
   console.log("  --fail-on-warning    Exit with non-zero when warnings exist");
+  console.log("  --bounded-memory     Release type graphs once all dependents are extracted (native only)");
+  console.log("  --memory-report      Print RSS per stage and heaviest modules (native only)");
+  console.log("  --stats <path>       Write generation counters and stage times as JSON (native only)");
+  console.log("  --class-layout       Precompute class page layout for the site generator (native only)");
+  console.log("  --search-index <path> Write a prebuilt full-text search index as JSON (native only)");
+  console.log("  --render-mdx <dir>   Render class and overview MDX pages directly (native only)");
+  console.log("  --render-options <path> Render options JSON from the reference plugin (native only)");
+  console.log("  --schema-version <n> Output schema 1 (default) or 2 with a shared string table (native only)");
+  console.log("  --package <dir>      Add a package root sharing one type checker; later --src/--types/--out apply to it (native only)");
   console.log("  --legacy             Use legacy JS parser (no Luau native)");
 }
 
@@ -18,6 +18,10 @@ fn main() {
         }
     }
 
+    if env::var("LUAU_DOCGEN_ENABLE_TRACING").as_deref() == Ok("1") {
+        cfg.define("LUAU_DOCGEN_ENABLE_TRACING", "ON");
+    }
+
     let dst = cfg.build();
 
     println!("cargo:rustc-link-search=native={}/lib", dst.display());
@@ -34,5 +38,7 @@ fn main() {
 
     if env::var("CARGO_CFG_TARGET_OS").as_deref() == Ok("windows") {
         println!("cargo:rustc-link-lib=stdc++");
+        // --memory-report가 GetProcessMemoryInfo를 쓴다.
+        println!("cargo:rustc-link-lib=psapi");
     }
 }
@@ -0,0 +1,344 @@
+// luau-docgen 코어의 핫 패스 마이크로벤치마크.
+// 내부 함수가 전부 static이라 번역 단위를 그대로 포함해서 직접 호출한다.
+#include "../src/docgen.cpp"
+
+#include <functional>
+
+struct BenchOptions
+{
+    int scale = 40;
+    int samples = 7;
+    std::string filter;
+    fs::path outPath;
+};
+
+struct BenchResult
+{
+    std::string name;
+    int iterations = 0;
+    std::vector<long long> sampleNs;
+    size_t sink = 0;
+};
+
+// 최적화로 결과가 버려지지 않도록 모든 벤치 결과를 여기에 누적한다.
+static volatile size_t benchSink = 0;
+
+static std::string makeSampleSource(int classCount)
+{
+    std::ostringstream out;
+    out << "--[=[\n"
+        << "\t@class Bench\n"
+        << "\n"
+        << "\tSynthetic module used by luau-docgen-bench.\n"
+        << "]=]\n"
+        << "local Bench = {}\n\n";
+
+    for (int i = 0; i < classCount; ++i)
+    {
+        std::string name = "Account" + std::to_string(i);
+        out << "--[=[\n"
+            << "\t@class " << name << "\n"
+            << "\t@within Bench\n"
+            << "\n"
+            << "\tHolds a balance and a list of transactions.\n"
+            << "\n"
+            << "\t```lua\n"
+            << "\tlocal account = " << name << ".new(\"owner\", 10)\n"
+            << "\t```\n"
+            << "]=]\n"
+            << "local " << name << " = {}\n"
+            << name << ".__index = " << name << "\n\n"
+            << "--- Transaction entry.\n"
+            << "export type " << name << "Entry = {\n"
+            << "\t-- Amount of the entry.\n"
+            << "\tamount: number,\n"
+            << "\t--- Optional memo shown in history.\n"
+            << "\tmemo: string?,\n"
+            << "\n"
+            << "\t-- Unix timestamp.\n"
+            << "\t-- Always in seconds.\n"
+            << "\ttimestamp: number,\n"
+            << "\tflags: { [string]: boolean }, -- Free-form flags\n"
+            << "}\n\n"
+            << "--[=[\n"
+            << "\tCreates a new account.\n"
+            << "\n"
+            << "\t@param owner string -- Owner name\n"
+            << "\t@param balance number -- Initial balance\n"
+            << "\t@return " << name << "\n"
+            << "\t@since 1.2.0\n"
+            << "]=]\n"
+            << "function " << name << ".new(owner: string, balance: number)\n"
+            << "\treturn setmetatable({ owner = owner, balance = balance, history = {} }, " << name << ")\n"
+            << "end\n\n"
+            << "--[=[\n"
+            << "\tDeposits money.\n"
+            << "\n"
+            << "\t@param amount number -- Amount to add\n"
+            << "\t@param memo string? -- Optional memo\n"
+            << "\t@return number -- New balance\n"
+            << "\t@error \"InvalidAmount\" -- When amount is negative\n"
+            << "\t@yields\n"
+            << "]=]\n"
+            << "function " << name << ":deposit(amount: number, memo: string?): number\n"
+            << "\tself.balance += amount\n"
+            << "\ttable.insert(self.history, { amount = amount, memo = memo, timestamp = os.time(), flags = {} })\n"
+            << "\treturn self.balance\n"
+            << "end\n\n"
+            << "--- Returns the history.\n"
+            << "--- @return {" << name << "Entry}\n"
+            << "function " << name << ":getHistory(): { " << name << "Entry }\n"
+            << "\treturn self.history\n"
+            << "end\n\n"
+            << "--- @private\n"
+            << "local function helper" << i << "(value: number, scale: number?): (number, string)\n"
+            << "\treturn value * (scale or 1), tostring(value)\n"
+            << "end\n\n"
+            << "Bench." << name << " = " << name << "\n"
+            << "Bench.helper" << i << " = helper" << i << "\n\n";
+    }
+
+    out << "return Bench\n";
+    return out.str();
+}
+
+struct BenchCase
+{
+    std::string name;
+    int iterations = 0;
+    std::function<size_t()> body;
+};
+
+static BenchResult runBench(const BenchCase& bench, int samples)
+{
+    BenchResult result;
+    result.name = bench.name;
+    result.iterations = bench.iterations;
+
+    // 첫 실행은 캐시/할당자 워밍업으로 버린다.
+    result.sink += bench.body();
+
+    for (int sample = 0; sample < samples; ++sample)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < bench.iterations; ++i)
+            result.sink += bench.body();
+        auto end = std::chrono::steady_clock::now();
+        result.sampleNs.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    }
+
+    benchSink = benchSink + result.sink;
+    return result;
+}
+
+static long long perOp(long long totalNs, int iterations)
+{
+    return iterations > 0 ? totalNs / iterations : 0;
+}
+
+static void writeResults(const std::vector<BenchResult>& results, const BenchOptions& options, std::ostream& out)
+{
+    JsonWriter writer(out);
+    writer.beginObject();
+    writer.key("scale");
+    writer.valueNumber(options.scale);
+    writer.key("samples");
+    writer.valueNumber(options.samples);
+    writer.key("benchmarks");
+    writer.beginArray();
+    for (const BenchResult& result : results)
+    {
+        std::vector<long long> sorted = result.sampleNs;
+        std::sort(sorted.begin(), sorted.end());
+
+        writer.beginObject();
+        writer.key("name");
+        writer.valueString(result.name);
+        writer.key("iterations");
+        writer.valueNumber(result.iterations);
+        writer.key("minNsPerOp");
+        writer.valueNumber(perOp(sorted.front(), result.iterations));
+        writer.key("medianNsPerOp");
+        writer.valueNumber(perOp(sorted[sorted.size() / 2], result.iterations));
+        writer.key("maxNsPerOp");
+        writer.valueNumber(perOp(sorted.back(), result.iterations));
+        writer.endObject();
+    }
+    writer.endArray();
+    writer.endObject();
+    out << "\n";
+}
+
+static void printUsage()
+{
+    std::cerr << "luau-docgen-bench\n\n"
+              << "Usage:\n"
+              << "  luau-docgen-bench [--scale <n>] [--samples <n>] [--filter <name>] [--out <path>]\n\n"
+              << "Options:\n"
+              << "  --scale <n>      Number of synthetic classes in the sample module (default: 40)\n"
+              << "  --samples <n>    Timed samples per benchmark (default: 7)\n"
+              << "  --filter <name>  Only run benchmarks whose name contains <name>\n"
+              << "  --out <path>     Write JSON results to a file instead of stdout\n";
+}
+
+static std::optional<BenchOptions> parseBenchArgs(int argc, char** argv)
+{
+    BenchOptions options;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--scale" && hasValue)
+            options.scale = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--samples" && hasValue)
+            options.samples = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--filter" && hasValue)
+            options.filter = argv[++i];
+        else if (arg == "--out" && hasValue)
+            options.outPath = argv[++i];
+        else
+            return std::nullopt;
+    }
+    return options;
+}
+
+int main(int argc, char** argv)
+{
+    std::optional<BenchOptions> parsed = parseBenchArgs(argc, argv);
+    if (!parsed)
+    {
+        printUsage();
+        return 1;
+    }
+    const BenchOptions& options = *parsed;
+
+    GeneratorOptions generatorOptions;
+    generatorOptions.rootDir = fs::current_path() / "luau-docgen-bench";
+    generatorOptions.srcDir = generatorOptions.rootDir / "src";
+    generatorOptions.generatorVersion = "bench";
+
+    std::string sampleText = makeSampleSource(options.scale);
+    std::vector<ModuleContext> contexts;
+    contexts.push_back(buildModuleContext(generatorOptions.srcDir / "Bench.luau", makeSource(sampleText), generatorOptions));
+    const ModuleContext& context = contexts.front();
+
+    // 타입 분석 벤치용으로 샘플 모듈을 한 번만 검사해 둔다.
+    DocgenFileResolver fileResolver(contexts);
+    DocgenConfigResolver configResolver;
+    configResolver.registerModule(context.moduleName, context.filePath, generatorOptions.rootDir);
+    Luau::Frontend frontend(&fileResolver, &configResolver, makeFrontendOptions(generatorOptions));
+    Luau::registerBuiltinGlobals(frontend, frontend.globals);
+    Luau::freeze(frontend.globals.globalTypes);
+    frontend.check(context.moduleName);
+
+    Luau::ModulePtr module = frontend.moduleResolver.getModule(context.moduleName);
+    if (!module || !module->hasModuleScope())
+    {
+        std::cerr << "[luau-docgen-bench] failed to type-check the sample module\n";
+        return 1;
+    }
+
+    TypeDisplayCache displayCache;
+    ModuleAnalysis analysis{context.moduleName, module, module->getModuleScope(), &displayCache};
+
+    std::vector<Luau::TypeId> functionTypes;
+    for (int i = 0; i < options.scale; ++i)
+    {
+        if (std::optional<Luau::TypeId> type = lookupBindingType(analysis.scope, "helper" + std::to_string(i)))
+            functionTypes.push_back(*type);
+    }
+
+    std::vector<std::pair<int, int>> fieldLines;
+    for (size_t i = 0; i < context.source.lineCount(); ++i)
+    {
+        if (context.source.line(i).find("export type") == std::string_view::npos)
+            continue;
+
+        int startLine = static_cast<int>(i) + 1;
+        for (size_t j = i + 1; j < context.source.lineCount() && trim(std::string(context.source.line(j))) != "}"; ++j)
+            fieldLines.push_back({startLine, static_cast<int>(j) + 1});
+    }
+
+    std::vector<InlineDocLine> inlineIndex = buildInlineDocIndex(context.source);
+
+    std::vector<Diagnostic> diagnostics;
+    Module docModule = generateModule(context, generatorOptions, {}, buildSymbols(context, &analysis, diagnostics));
+
+    std::vector<BenchCase> benches = {
+        {"makeSource", 200, [&] {
+             return makeSource(sampleText).lineCount();
+         }},
+        {"scanLines/scalar", 200, [&] {
+             return scanLines(sampleText, ScanKernel::Scalar).lineOffsets.size();
+         }},
+    };
+
+    // 이 CPU에서 돌릴 수 있는 벡터 커널만 잰다.
+    ScanKernel kernel = detectScanKernel();
+    if (kernel != ScanKernel::Scalar)
+        benches.push_back({"scanLines/sse2", 200, [&] {
+                               return scanLines(sampleText, ScanKernel::Sse2).lineOffsets.size();
+                           }});
+    if (kernel == ScanKernel::Avx2)
+        benches.push_back({"scanLines/avx2", 200, [&] {
+                               return scanLines(sampleText, ScanKernel::Avx2).lineOffsets.size();
+                           }});
+
+    benches.insert(benches.end(), {
+        {"extractDocBlocks", 200, [&] {
+             return extractDocBlocks(context.source).size();
+         }},
+        {"parseDocBlock", 200, [&] {
+             size_t count = 0;
+             for (const DocBlock& block : context.blocks)
+                 count += parseDocBlock(docBlockLines(context.source, block)).descriptionLines.size();
+             return count;
+         }},
+        {"collectBindings", 200, [&] {
+             return collectBindings(context.source).size();
+         }},
+        {"buildInlineDocIndex", 200, [&] {
+             return buildInlineDocIndex(context.source).size();
+         }},
+        {"collectInlineDocLines", 200, [&] {
+             size_t count = 0;
+             for (const auto& [startLine, targetLine] : fieldLines)
+                 count += collectInlineDocLines(context.source, inlineIndex, startLine, targetLine).size();
+             return count;
+         }},
+        {"sha1", 200, [&] {
+             return sha1(context.source.content).size();
+         }},
+        {"JsonWriter", 200, [&] {
+             std::ostringstream out;
+             JsonWriter writer(out);
+             writeModule(writer, docModule);
+             return static_cast<size_t>(out.tellp());
+         }},
+        // 캐시를 넘기면 두 번째 호출부터 표시 문자열 생성이 생략되므로 캐시 없이 잰다.
+        {"analyzeFunctionType", 200, [&] {
+             size_t count = 0;
+             for (Luau::TypeId type : functionTypes)
+                 count += analyzeFunctionType(type, false, nullptr).display.size();
+             return count;
+         }},
+    });
+
+    std::vector<BenchResult> results;
+    for (const BenchCase& bench : benches)
+    {
+        if (!options.filter.empty() && bench.name.find(options.filter) == std::string::npos)
+            continue;
+        results.push_back(runBench(bench, options.samples));
+    }
+
+    if (options.outPath.empty())
+    {
+        writeResults(results, options, std::cout);
+        return 0;
+    }
+
+    std::ofstream outFile(options.outPath, std::ios::binary);
+    writeResults(results, options, outFile);
+    return 0;
+}
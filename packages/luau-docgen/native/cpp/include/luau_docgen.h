@@ -1,10 +1,26 @@
 #ifndef LUAU_DOCGEN_H
 #define LUAU_DOCGEN_H
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+#define LUAU_DOCGEN_ERROR (-1)
+#define LUAU_DOCGEN_OK 0
+#define LUAU_DOCGEN_WARNINGS 1
+#define LUAU_DOCGEN_BUFFER_TOO_SMALL 2
+
+/* 같은 Frontend로 함께 분석할 추가 패키지. 경로 규칙은 LuauDocgenOptions의 root_dir/src_dir/types_dir/out_path와 같다. */
+struct LuauDocgenPackageOptions
+{
+    const char* root_dir;
+    const char* src_dir;
+    const char* types_dir;
+    const char* out_path;
+};
+
 struct LuauDocgenOptions
 {
     const char* root_dir;
@@ -13,10 +29,50 @@ struct LuauDocgenOptions
     const char* out_path;
     const char* generator_version;
     int fail_on_warning;
+    int verbose;
+    int bounded_memory;
+    int lazy_check;
+    double module_time_limit_sec;
+    int instantiation_limit;
+    int unifier_iteration_limit;
+    const char* trace_path;
+    int memory_report;
+    const char* stats_path;
+    int class_layout;
+    const char* search_index_path;
+    /* render_dir가 있으면 클래스/개요 MDX를 직접 렌더링한다. 옵션은 generate.js가 만든 JSON 문자열이다. */
+    const char* render_dir;
+    const char* render_options_json;
+    /* 0이면 1. 2는 문자열 테이블을 쓰는 압축 스키마다. */
+    int schema_version;
+    /* luau_docgen_run 전용. 세션은 첫 루트만 쓴다. */
+    const struct LuauDocgenPackageOptions* packages;
+    size_t package_count;
 };
 
 int luau_docgen_run(const LuauDocgenOptions* options);
 
+typedef struct LuauDocgenSession LuauDocgenSession;
+
+typedef void (*LuauDocgenModuleCallback)(const char* module_id, const char* json, size_t json_size, void* user_data);
+
+/* out_path는 세션에서 사용하지 않는다. bounded_memory를 켜면 NULL을 반환한다.
+   세션 함수는 같은 세션에 대해 동시에 호출하면 안 된다. */
+LuauDocgenSession* luau_docgen_session_create(const LuauDocgenOptions* options);
+int luau_docgen_session_update_file(LuauDocgenSession* session, const char* path, const char* contents, size_t size);
+int luau_docgen_session_remove_file(LuauDocgenSession* session, const char* path);
+
+/* buffer가 NULL이거나 capacity가 부족하면 out_size만 채우고 LUAU_DOCGEN_BUFFER_TOO_SMALL을 반환한다.
+   search_index_path를 주면 출력을 다시 만드는 generate마다 검색 인덱스 파일도 다시 쓴다. */
+int luau_docgen_session_generate(LuauDocgenSession* session, char* buffer, size_t capacity, size_t* out_size);
+/* 모듈 JSON은 schema_version과 상관없이 항상 v1 모듈 객체다. 문자열 테이블은 문서 전체 단위라 모듈별로 나눌 수 없다. */
+int luau_docgen_session_generate_modules(
+    LuauDocgenSession* session,
+    LuauDocgenModuleCallback callback,
+    void* user_data
+);
+void luau_docgen_session_destroy(LuauDocgenSession* session);
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,22 +1,56 @@
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cctype>
+#include <chrono>
+#include <condition_variable>
 #include <cstdint>
+#include <cstdlib>
 #include <cstring>
+#include <deque>
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <iterator>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <set>
+#include <shared_mutex>
 #include <sstream>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 #include "luau_docgen.h"
+#include "simd_scan.h"
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__APPLE__)
+#include <mach/mach.h>
+#include <sys/resource.h>
+#endif
 
 #include <Luau/Ast.h>
+#include <Luau/Cancellation.h>
+#include <Luau/Common.h>
 #include <Luau/Config.h>
+#include <Luau/Error.h>
 #include <Luau/Frontend.h>
 #include <Luau/LuauConfig.h>
 #include <Luau/Lexer.h>
@@ -28,6 +62,9 @@
 #include <Luau/Type.h>
 #include <Luau/TypePack.h>
 
+LUAU_FASTINT(LuauTarjanChildLimit)
+LUAU_FASTINT(LuauTypeInferIterationLimit)
+
 namespace fs = std::filesystem;
 
 struct Diagnostic
@@ -95,11 +132,15 @@ struct DocState
     std::string deprecatedDescription;
 };
 
+// 내용 줄은 들고 있지 않고 줄 범위만 기록한다. 필요할 때 docBlockLines로 원본에서 잘라 온다.
 struct DocBlock
 {
     int startLine = 0;
     int endLine = 0;
-    std::vector<std::string> contentLines;
+    // '--[=[' 블록이면 true, 연속된 '---' 줄이면 false
+    bool longComment = false;
+    // '--[=[' 블록에서 endLine 줄에 ']=]'가 있는지
+    bool closed = false;
 };
 
 struct ParsedDoc
@@ -174,12 +215,37 @@ struct Module
     std::vector<Symbol> symbols;
 };
 
+// 줄마다 문자열을 만들지 않고 정규화된 본문 하나와 줄 시작 오프셋만 둔다.
 struct Source
 {
-    std::string rawContent;
     std::string content;
-    std::vector<std::string> lines;
     std::vector<size_t> lineOffsets;
+    // 줄 안에 "--"가 있는지 (simd_scan). 주석이 없는 줄은 문서 블록 탐색에서 건너뛴다.
+    std::vector<bool> lineHasDashes;
+    // 정규화 전 원본 기준
+    std::string rawHash;
+    size_t rawBytes = 0;
+
+    size_t lineCount() const
+    {
+        return lineOffsets.size();
+    }
+
+    std::string_view line(size_t index) const
+    {
+        size_t start = lineOffsets[index];
+        size_t end = index + 1 < lineOffsets.size() ? lineOffsets[index + 1] - 1 : content.size();
+        return std::string_view(content).substr(start, end - start);
+    }
+};
+
+// --package로 받은 추가 루트. 경로는 resolveGeneratorOptions에서 이미 풀려 있다.
+struct PackageOptions
+{
+    fs::path rootDir;
+    fs::path srcDir;
+    fs::path typesDir;
+    fs::path outPath;
 };
 
 struct GeneratorOptions
@@ -188,8 +254,306 @@ struct GeneratorOptions
     fs::path srcDir;
     fs::path typesDir;
     std::string generatorVersion;
+    bool verbose = false;
+    bool boundedMemory = false;
+    bool lazyCheck = false;
+    std::optional<double> moduleTimeLimitSec;
+    std::optional<int> instantiationLimit;
+    std::optional<int> unifierIterationLimit;
+    fs::path tracePath;
+    bool memoryReport = false;
+    fs::path statsPath;
+    bool classLayout = false;
+    fs::path searchIndexPath;
+    fs::path renderDir;
+    std::string renderOptionsJson;
+    int schemaVersion = 1;
+    std::vector<PackageOptions> packages;
+};
+
+// LUAU_DOCGEN_TRACING 없이 빌드하면 인자 평가까지 포함해 계측 코드가 전부 사라진다.
+#ifdef LUAU_DOCGEN_TRACING
+struct TraceEvent
+{
+    const char* name = "";
+    std::string detail;
+    long long startUs = 0;
+    long long durationUs = 0;
+    int threadId = 0;
+};
+
+// --trace 실행 동안의 구간을 모아 Chrome trace 이벤트로 쓴다.
+struct DocgenTracer
+{
+    std::mutex mutex;
+    std::vector<TraceEvent> events;
+    std::unordered_map<std::thread::id, int> threadIds;
+    std::chrono::steady_clock::time_point origin = std::chrono::steady_clock::now();
+    std::atomic<bool> enabled{false};
+
+    void start()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        events.clear();
+        origin = std::chrono::steady_clock::now();
+        enabled = true;
+    }
+
+    long long nowUs() const
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - origin).count();
+    }
+
+    void record(const char* name, std::string detail, long long startUs, long long endUs)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto inserted = threadIds.emplace(std::this_thread::get_id(), static_cast<int>(threadIds.size()) + 1);
+        events.push_back({name, std::move(detail), startUs, endUs - startUs, inserted.first->second});
+    }
+};
+
+static DocgenTracer& docgenTracer()
+{
+    static DocgenTracer tracer;
+    return tracer;
+}
+
+struct TraceScope
+{
+    const char* name;
+    std::string detail;
+    long long startUs = 0;
+    bool active = false;
+
+    TraceScope(const char* name, std::string detail)
+        : name(name)
+    {
+        DocgenTracer& tracer = docgenTracer();
+        if (!tracer.enabled)
+            return;
+
+        this->detail = std::move(detail);
+        startUs = tracer.nowUs();
+        active = true;
+    }
+
+    ~TraceScope()
+    {
+        if (!active)
+            return;
+
+        DocgenTracer& tracer = docgenTracer();
+        tracer.record(name, std::move(detail), startUs, tracer.nowUs());
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+};
+
+#define DOCGEN_TRACE_CONCAT_INNER(a, b) a##b
+#define DOCGEN_TRACE_CONCAT(a, b) DOCGEN_TRACE_CONCAT_INNER(a, b)
+#define DOCGEN_TRACE_SCOPE(name, detail) TraceScope DOCGEN_TRACE_CONCAT(docgenTraceScope, __LINE__)(name, detail)
+#else
+#define DOCGEN_TRACE_SCOPE(name, detail) ((void)0)
+#endif
+
+struct MemoryUsage
+{
+    size_t currentRss = 0;
+    size_t peakRss = 0;
+};
+
+static MemoryUsage readMemoryUsage()
+{
+    MemoryUsage usage;
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    {
+        usage.currentRss = counters.WorkingSetSize;
+        usage.peakRss = counters.PeakWorkingSetSize;
+    }
+#elif defined(__APPLE__)
+    mach_task_basic_info_data_t info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) == KERN_SUCCESS)
+        usage.currentRss = info.resident_size;
+
+    struct rusage resourceUsage;
+    if (getrusage(RUSAGE_SELF, &resourceUsage) == 0)
+        usage.peakRss = static_cast<size_t>(resourceUsage.ru_maxrss);
+#else
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+        bool isCurrent = line.rfind("VmRSS:", 0) == 0;
+        bool isPeak = line.rfind("VmHWM:", 0) == 0;
+        if (!isCurrent && !isPeak)
+            continue;
+
+        size_t kilobytes = std::strtoull(line.c_str() + 6, nullptr, 10);
+        if (isCurrent)
+            usage.currentRss = kilobytes * 1024;
+        else
+            usage.peakRss = kilobytes * 1024;
+    }
+#endif
+    return usage;
+}
+
+static size_t stringHeapBytes(const std::string& value)
+{
+    // SSO 버퍼 안에 들어가는 짧은 문자열은 추가 할당이 없다. 버퍼 크기는 표준 라이브러리마다 다르므로
+    // 빈 문자열의 capacity로 잰다 (libstdc++ 15, libc++ 22, MSVC 15).
+    static const size_t inlineCapacity = std::string().capacity();
+    return value.capacity() > inlineCapacity ? value.capacity() + 1 : 0;
+}
+
+static size_t stringsHeapBytes(const std::vector<std::string>& values)
+{
+    size_t bytes = values.capacity() * sizeof(std::string);
+    for (const std::string& value : values)
+        bytes += stringHeapBytes(value);
+    return bytes;
+}
+
+static size_t estimateSourceBytes(const Source& source)
+{
+    return stringHeapBytes(source.content) + stringHeapBytes(source.rawHash) + source.lineOffsets.capacity() * sizeof(size_t)
+        + source.lineHasDashes.capacity() / 8;
+}
+
+static size_t estimateSymbolBytes(const Symbol& symbol)
+{
+    size_t bytes = sizeof(Symbol);
+    for (const std::string* value : {&symbol.kind, &symbol.name, &symbol.qualifiedName, &symbol.file, &symbol.summary,
+             &symbol.descriptionMarkdown, &symbol.visibility, &symbol.types.display, &symbol.types.propertyType,
+             &symbol.types.typeAlias, &symbol.types.indexName})
+        bytes += stringHeapBytes(*value);
+
+    bytes += symbol.tags.capacity() * sizeof(TagValue);
+    for (const TagValue& tag : symbol.tags)
+        bytes += stringHeapBytes(tag.name) + stringHeapBytes(tag.value) + stringHeapBytes(tag.description);
+
+    bytes += symbol.types.params.capacity() * sizeof(ParamInfo);
+    for (const ParamInfo& param : symbol.types.params)
+        bytes += stringHeapBytes(param.name) + stringHeapBytes(param.type) + stringsHeapBytes(param.description);
+
+    bytes += symbol.types.returns.capacity() * sizeof(ReturnInfo);
+    for (const ReturnInfo& ret : symbol.types.returns)
+        bytes += stringHeapBytes(ret.type) + stringsHeapBytes(ret.description);
+
+    bytes += symbol.types.errors.capacity() * sizeof(ErrorInfo);
+    for (const ErrorInfo& error : symbol.types.errors)
+        bytes += stringHeapBytes(error.type) + stringsHeapBytes(error.description);
+
+    bytes += symbol.types.fields.capacity() * sizeof(FieldInfo);
+    for (const FieldInfo& field : symbol.types.fields)
+        bytes += stringHeapBytes(field.name) + stringHeapBytes(field.type) + stringHeapBytes(field.description);
+
+    return bytes;
+}
+
+struct ModuleMemory
+{
+    size_t typeCount = 0;
+    size_t typePackCount = 0;
+    size_t arenaBytes = 0;
+    size_t sourceBytes = 0;
+    size_t symbolBytes = 0;
+
+    size_t total() const
+    {
+        return arenaBytes + sourceBytes + symbolBytes;
+    }
+};
+
+struct MemoryStage
+{
+    std::string name;
+    MemoryUsage usage;
+};
+
+// --memory-report: 단계 경계마다 RSS를 찍고, 모듈별로 타입 arena와 유지 중인 소스/심볼 크기를 모은다.
+struct MemoryReport
+{
+    std::vector<MemoryStage> stages;
+    std::unordered_map<std::string, ModuleMemory> modules;
+
+    void sampleStage(const char* name)
+    {
+        stages.push_back({name, readMemoryUsage()});
+    }
+
+    // arena 크기는 Type/TypePack 노드 수 기준의 근사치이며, 노드가 따로 잡는 힙은 포함하지 않는다.
+    void recordArena(const std::string& moduleName, const Luau::ModulePtr& module)
+    {
+        ModuleMemory& entry = modules[moduleName];
+        entry.typeCount = module->internalTypes.types.size() + module->interfaceTypes.types.size();
+        entry.typePackCount = module->internalTypes.typePacks.size() + module->interfaceTypes.typePacks.size();
+        entry.arenaBytes = entry.typeCount * sizeof(Luau::Type) + entry.typePackCount * sizeof(Luau::TypePackVar);
+    }
+
+    void recordSource(const std::string& moduleName, const Source& source)
+    {
+        modules[moduleName].sourceBytes += estimateSourceBytes(source);
+    }
+
+    void recordSymbols(const std::string& moduleName, const std::vector<Symbol>& symbols)
+    {
+        size_t bytes = symbols.capacity() * sizeof(Symbol);
+        for (const Symbol& symbol : symbols)
+            bytes += estimateSymbolBytes(symbol) - sizeof(Symbol);
+        modules[moduleName].symbolBytes += bytes;
+    }
 };
 
+static std::string formatMegabytes(size_t bytes)
+{
+    std::ostringstream stream;
+    stream << std::fixed << std::setprecision(1) << static_cast<double>(bytes) / (1024.0 * 1024.0) << " MiB";
+    return stream.str();
+}
+
+static void printMemoryReport(const MemoryReport& report, size_t topCount)
+{
+    std::cerr << "[luau-docgen] memory by stage (rss / peak rss)\n";
+    for (const MemoryStage& stage : report.stages)
+    {
+        std::cerr << "  " << std::left << std::setw(24) << stage.name << std::right << std::setw(12)
+                  << formatMegabytes(stage.usage.currentRss) << " / " << formatMegabytes(stage.usage.peakRss) << "\n";
+    }
+
+    std::vector<std::pair<std::string, ModuleMemory>> ranked(report.modules.begin(), report.modules.end());
+    std::sort(ranked.begin(), ranked.end(), [](const auto& a, const auto& b) {
+        if (a.second.total() != b.second.total())
+            return a.second.total() > b.second.total();
+        return a.first < b.first;
+    });
+    if (ranked.size() > topCount)
+        ranked.resize(topCount);
+
+    std::cerr << "[luau-docgen] heaviest modules (approximate retained bytes)\n";
+    std::cerr << "  " << std::left << std::setw(40) << "module" << std::right << std::setw(10) << "types" << std::setw(10)
+              << "packs" << std::setw(14) << "arena" << std::setw(14) << "source" << std::setw(14) << "symbols"
+              << std::setw(14) << "total" << "\n";
+    for (const auto& [name, memory] : ranked)
+    {
+        std::cerr << "  " << std::left << std::setw(40) << name << std::right << std::setw(10) << memory.typeCount
+                  << std::setw(10) << memory.typePackCount << std::setw(14) << formatMegabytes(memory.arenaBytes)
+                  << std::setw(14) << formatMegabytes(memory.sourceBytes) << std::setw(14)
+                  << formatMegabytes(memory.symbolBytes) << std::setw(14) << formatMegabytes(memory.total()) << "\n";
+    }
+
+    size_t peakRss = 0;
+    for (const MemoryStage& stage : report.stages)
+        peakRss = std::max(peakRss, stage.usage.peakRss);
+
+    // 스크립트에서 읽기 쉽도록 마지막 줄은 고정 형식으로 남긴다.
+    std::cerr << "[luau-docgen] memory: peak_rss_bytes=" << peakRss << "\n";
+}
+
 static std::string normalizePath(const fs::path& path)
 {
     return path.lexically_normal().generic_string();
@@ -219,52 +583,92 @@ static std::string trim(const std::string& value)
     return trimRight(trimLeft(value));
 }
 
-static Source loadSource(const fs::path& filePath)
+static std::string_view trimView(std::string_view value)
 {
-    std::ifstream file(filePath, std::ios::binary);
-    std::ostringstream buffer;
-    buffer << file.rdbuf();
+    size_t start = 0;
+    while (start < value.size() && std::isspace(static_cast<unsigned char>(value[start])))
+        start++;
+
+    size_t end = value.size();
+    while (end > start && std::isspace(static_cast<unsigned char>(value[end - 1])))
+        end--;
 
-    std::string rawContent = buffer.str();
+    return value.substr(start, end - start);
+}
 
-    std::string normalized;
-    normalized.reserve(rawContent.size());
-    for (size_t i = 0; i < rawContent.size(); ++i)
+static bool isBlankLine(std::string_view line)
+{
+    for (char ch : line)
     {
-        char ch = rawContent[i];
-        if (ch == '\r')
-        {
-            if (i + 1 < rawContent.size() && rawContent[i + 1] == '\n')
-                continue;
-            normalized.push_back('\n');
-        }
-        else
-        {
-            normalized.push_back(ch);
-        }
+        if (!std::isspace(static_cast<unsigned char>(ch)))
+            return false;
     }
+    return true;
+}
 
-    Source source;
-    source.rawContent = rawContent;
-    source.content = normalized;
+static bool startsAfterIndent(std::string_view line, std::string_view prefix)
+{
+    size_t start = 0;
+    while (start < line.size() && std::isspace(static_cast<unsigned char>(line[start])))
+        start++;
+    return line.compare(start, prefix.size(), prefix) == 0;
+}
+
+static std::string sha1(const std::string& input);
 
-    size_t lineStart = 0;
-    for (size_t i = 0; i < normalized.size(); ++i)
+// '\r\n'과 '\r'을 '\n'으로 바꾼다. '\r' 사이 구간은 memchr로 찾아 통째로 옮긴다.
+static void normalizeLineEndings(std::string& text)
+{
+    size_t read = 0;
+    size_t write = 0;
+    while (read < text.size())
     {
-        if (normalized[i] == '\n')
-        {
-            source.lineOffsets.push_back(lineStart);
-            source.lines.push_back(normalized.substr(lineStart, i - lineStart));
-            lineStart = i + 1;
-        }
+        const void* found = std::memchr(text.data() + read, '\r', text.size() - read);
+        size_t next = found ? static_cast<size_t>(static_cast<const char*>(found) - text.data()) : text.size();
+        if (write != read)
+            std::memmove(&text[write], &text[read], next - read);
+        write += next - read;
+        if (next == text.size())
+            break;
+
+        text[write++] = '\n';
+        read = next + 1;
+        if (read < text.size() && text[read] == '\n')
+            read++;
     }
+    text.resize(write);
+}
+
+// 원본 버퍼 하나를 제자리에서 정규화하고 줄 오프셋만 남긴다. 해시는 정규화 전에 계산한다.
+// 대부분의 파일은 '\r'이 없어 한 번의 벡터 스캔으로 끝나고, '\r'이 있으면 정규화한 뒤 한 번 더 스캔한다.
+static Source makeSource(std::string rawContent)
+{
+    Source source;
+    source.rawHash = sha1(rawContent);
+    source.rawBytes = rawContent.size();
 
-    source.lineOffsets.push_back(lineStart);
-    source.lines.push_back(normalized.substr(lineStart));
+    LineScan scan = scanLines(rawContent);
+    if (scan.hasCarriageReturn)
+    {
+        normalizeLineEndings(rawContent);
+        scan = scanLines(rawContent);
+    }
 
+    source.content = std::move(rawContent);
+    source.lineOffsets = std::move(scan.lineOffsets);
+    source.lineHasDashes = std::move(scan.lineHasDashes);
     return source;
 }
 
+static Source loadSource(const fs::path& filePath)
+{
+    std::ifstream file(filePath, std::ios::binary);
+    std::ostringstream buffer;
+    buffer << file.rdbuf();
+
+    return makeSource(buffer.str());
+}
+
 static std::vector<std::string> dedentLines(const std::vector<std::string>& lines)
 {
     size_t minIndent = std::string::npos;
@@ -296,70 +700,48 @@ static std::vector<std::string> dedentLines(const std::vector<std::string>& line
     return result;
 }
 
-static std::vector<DocBlock> extractDocBlocks(const std::vector<std::string>& lines)
+// 본문을 한 번 훑으며 블록의 줄 범위만 찾는다. 블록 내용은 복사하지 않는다.
+static std::vector<DocBlock> extractDocBlocks(const Source& source)
 {
     std::vector<DocBlock> blocks;
+    size_t lineCount = source.lineCount();
     size_t index = 0;
 
-    while (index < lines.size())
+    while (index < lineCount)
     {
-        const std::string& line = lines[index];
-        std::string trimmed = trim(line);
+        if (!source.lineHasDashes[index])
+        {
+            index++;
+            continue;
+        }
+
+        std::string_view line = source.line(index);
 
-        if (trimmed.rfind("---", 0) == 0)
+        if (startsAfterIndent(line, "---"))
         {
             DocBlock block;
             block.startLine = static_cast<int>(index) + 1;
-            while (index < lines.size() && trim(lines[index]).rfind("---", 0) == 0)
-            {
-                std::string raw = lines[index];
-                size_t pos = raw.find("---");
-                std::string content = pos == std::string::npos ? "" : raw.substr(pos + 3);
-                if (!content.empty() && content[0] == ' ')
-                    content = content.substr(1);
-                block.contentLines.push_back(content);
+            while (index < lineCount && startsAfterIndent(source.line(index), "---"))
                 index++;
-            }
             block.endLine = static_cast<int>(index);
             blocks.push_back(block);
             continue;
         }
 
-        if (trimmed.rfind("--[=[", 0) == 0)
+        if (startsAfterIndent(line, "--[=["))
         {
             DocBlock block;
             block.startLine = static_cast<int>(index) + 1;
-            bool foundEnd = false;
-            std::string current = lines[index];
-            size_t startOffset = current.find("--[=[");
-            if (startOffset != std::string::npos)
-            {
-                std::string afterStart = current.substr(startOffset + 5);
-                if (!afterStart.empty())
-                    block.contentLines.push_back(afterStart);
-            }
+            block.longComment = true;
             index++;
 
-            while (index < lines.size())
-            {
-                std::string currentLine = lines[index];
-                size_t endIndex = currentLine.find("]=]");
-                if (endIndex != std::string::npos)
-                {
-                    std::string beforeEnd = currentLine.substr(0, endIndex);
-                    if (!beforeEnd.empty())
-                        block.contentLines.push_back(beforeEnd);
-                    foundEnd = true;
-                    break;
-                }
-
-                block.contentLines.push_back(currentLine);
+            while (index < lineCount && source.line(index).find("]=]") == std::string_view::npos)
                 index++;
-            }
 
-            block.endLine = foundEnd ? static_cast<int>(index) + 1 : static_cast<int>(lines.size());
+            block.closed = index < lineCount;
+            block.endLine = block.closed ? static_cast<int>(index) + 1 : static_cast<int>(lineCount);
             blocks.push_back(block);
-            index = foundEnd ? index + 1 : lines.size();
+            index = block.closed ? index + 1 : lineCount;
             continue;
         }
 
@@ -369,24 +751,69 @@ static std::vector<DocBlock> extractDocBlocks(const std::vector<std::string>& li
     return blocks;
 }
 
-static std::pair<std::string, std::string> splitTagValue(const std::string& value)
+static std::vector<std::string> docBlockLines(const Source& source, const DocBlock& block)
 {
-    std::istringstream stream(value);
-    std::string name;
-    stream >> name;
-    std::string rest;
-    std::getline(stream, rest);
-    return {name, trim(rest)};
+    std::vector<std::string> lines;
+    size_t first = static_cast<size_t>(block.startLine) - 1;
+    size_t last = static_cast<size_t>(block.endLine) - 1;
+
+    if (!block.longComment)
+    {
+        lines.reserve(last - first + 1);
+        for (size_t index = first; index <= last; ++index)
+        {
+            std::string_view raw = source.line(index);
+            size_t pos = raw.find("---");
+            std::string_view content = pos == std::string_view::npos ? std::string_view() : raw.substr(pos + 3);
+            if (!content.empty() && content[0] == ' ')
+                content.remove_prefix(1);
+            lines.emplace_back(content);
+        }
+        return lines;
+    }
+
+    std::string_view opening = source.line(first);
+    size_t startOffset = opening.find("--[=[");
+    if (startOffset != std::string_view::npos && startOffset + 5 < opening.size())
+        lines.emplace_back(opening.substr(startOffset + 5));
+
+    size_t middleEnd = block.closed ? last : last + 1;
+    for (size_t index = first + 1; index < middleEnd; ++index)
+        lines.emplace_back(source.line(index));
+
+    if (block.closed)
+    {
+        std::string_view closing = source.line(last);
+        size_t endIndex = closing.find("]=]");
+        if (endIndex > 0)
+            lines.emplace_back(closing.substr(0, endIndex));
+    }
+
+    return lines;
+}
+
+// 첫 단어와 나머지(앞뒤 공백 제거)로 나눈다.
+static std::pair<std::string_view, std::string_view> splitTagValue(std::string_view value)
+{
+    size_t start = 0;
+    while (start < value.size() && std::isspace(static_cast<unsigned char>(value[start])))
+        start++;
+
+    size_t end = start;
+    while (end < value.size() && !std::isspace(static_cast<unsigned char>(value[end])))
+        end++;
+
+    return {value.substr(start, end - start), trimView(value.substr(end))};
 }
 
-static std::pair<std::string, std::string> parseTypeAndDescription(const std::string& value)
+static std::pair<std::string, std::string> parseTypeAndDescription(std::string_view value)
 {
     size_t separator = value.find("--");
-    if (separator == std::string::npos)
-        return {trim(value), ""};
+    if (separator == std::string_view::npos)
+        return {std::string(trimView(value)), ""};
 
-    std::string typePart = trim(value.substr(0, separator));
-    std::string description = trim(value.substr(separator + 2));
+    std::string typePart(trimView(value.substr(0, separator)));
+    std::string description(trimView(value.substr(separator + 2)));
     return {typePart, description};
 }
 
@@ -397,12 +824,12 @@ struct ParsedMemberName
     bool isMethod = false;
 };
 
-static ParsedMemberName parseMemberName(const std::string& raw)
+static ParsedMemberName parseMemberName(std::string_view raw)
 {
     ParsedMemberName result;
     result.name = raw;
 
-    if (raw.rfind("~:", 0) == 0)
+    if (raw.compare(0, 2, "~:") == 0)
     {
         result.within = "~";
         result.name = raw.substr(2);
@@ -410,17 +837,17 @@ static ParsedMemberName parseMemberName(const std::string& raw)
         return result;
     }
 
-    if (raw.rfind("~.", 0) == 0)
+    if (raw.compare(0, 2, "~.") == 0)
     {
         result.within = "~";
         result.name = raw.substr(2);
         return result;
     }
 
-    size_t colon = raw.rfind(:);
-    size_t dot = raw.rfind(.);
+    size_t colon = raw.rfind(':');
+    size_t dot = raw.rfind('.');
 
-    if (colon != std::string::npos && colon > dot)
+    if (colon != std::string_view::npos && (dot == std::string_view::npos || colon > dot))
     {
         result.within = raw.substr(0, colon);
         result.name = raw.substr(colon + 1);
@@ -428,7 +855,7 @@ static ParsedMemberName parseMemberName(const std::string& raw)
         return result;
     }
 
-    if (dot != std::string::npos)
+    if (dot != std::string_view::npos)
     {
         result.within = raw.substr(0, dot);
         result.name = raw.substr(dot + 1);
@@ -438,255 +865,348 @@ static ParsedMemberName parseMemberName(const std::string& raw)
     return result;
 }
 
-static ParsedDoc parseDocBlock(const std::vector<std::string>& contentLines)
+// 들여쓴 다음 줄을 이어 붙일 대상. @param/@return/@error의 설명 줄 목록이거나, @prop/@type/@field의 타입·설명 문자열이다.
+struct ContinuationState
 {
-    ParsedDoc doc;
-    std::vector<std::string> lines = dedentLines(contentLines);
-    bool inFence = false;
-    struct ContinuationState
+    std::vector<std::string>* lines = nullptr;
+    std::string* text = nullptr;
+
+    explicit operator bool() const
     {
-        std::vector<std::string>* description = nullptr;
-        std::string* type = nullptr;
-    };
-    ContinuationState continuation;
+        return lines || text;
+    }
 
-    for (const std::string& line : lines)
+    void append(std::string line)
     {
-        std::string trimmed = trim(line);
+        if (lines)
+        {
+            lines->push_back(std::move(line));
+            return;
+        }
 
-        if (trimmed.rfind("```", 0) == 0)
-            inFence = !inFence;
+        if (!text->empty())
+            *text += "\n";
+        *text += line;
+    }
+};
 
-        size_t indentSize = line.find_first_not_of(" \t");
-        if (indentSize == std::string::npos)
-            indentSize = line.size();
-        std::string afterIndent = line.substr(indentSize);
-        std::string indent = line.substr(0, indentSize);
-        bool isContinuation =
-            continuation &&
-            (!indent.empty() && (indent.find('\t') != std::string::npos || indent.size() >= 2)) &&
-            !(trim(afterIndent).rfind("@", 0) == 0 || trim(afterIndent).rfind(".", 0) == 0);
+struct TagLine
+{
+    std::string_view name;
+    std::string_view value;
+};
 
-        if (!inFence && isContinuation)
-        {
-            continuation->push_back(trimRight(afterIndent));
-            continue;
-        }
+using TagHandler = void (*)(ParsedDoc& doc, const TagLine& tag, ContinuationState& continuation);
 
-        continuation = nullptr;
+static void setWithinFromMember(ParsedDoc& doc, const ParsedMemberName& parsed)
+{
+    if (!parsed.within.empty() && doc.state.within.empty())
+        doc.state.within = parsed.within;
+}
 
-        if (!inFence && trimmed.rfind("@", 0) == 0)
-        {
-            std::string tagLine = trimmed.substr(1);
-            std::string tagName;
-            std::string tagValue;
-            size_t space = tagLine.find_first_of(" \t");
-            if (space == std::string::npos)
-            {
-                tagName = tagLine;
-                tagValue = "";
-            }
-            else
-            {
-                tagName = tagLine.substr(0, space);
-                tagValue = trim(tagLine.substr(space + 1));
-            }
+static void parseClassTag(ParsedDoc& doc, const TagLine& tag, ContinuationState&)
+{
+    doc.typeTags.push_back({"class", std::string(tag.value), "", false});
+}
 
-            if (tagName == "class")
-            {
-                doc.typeTags.push_back({"class", tagValue, "", false});
-            }
-            else if (tagName == "prop")
-            {
-                auto [rawName, rest] = splitTagValue(tagValue);
-                ParsedMemberName parsed = parseMemberName(rawName);
-                if (!parsed.within.empty() && doc.state.within.empty())
-                    doc.state.within = parsed.within;
-                doc.typeTags.push_back({"property", parsed.name, rest, false});
-                if (!rest.empty() && rest.find("--") == std::string::npos)
-                    continuation.type = &doc.typeTags.back().type;
-            }
-            else if (tagName == "type")
-            {
-                auto [name, rest] = splitTagValue(tagValue);
-                doc.typeTags.push_back({"type", name, rest, false});
-                if (!rest.empty() && rest.find("--") == std::string::npos)
-                    continuation.type = &doc.typeTags.back().type;
-            }
-            else if (tagName == "interface")
-            {
-                doc.typeTags.push_back({"interface", tagValue, "", false});
-            }
-            else if (tagName == "function")
-            {
-                ParsedMemberName parsed = parseMemberName(tagValue);
-                if (!parsed.within.empty() && doc.state.within.empty())
-                    doc.state.within = parsed.within;
-                doc.typeTags.push_back({"function", parsed.name, "", parsed.isMethod});
-            }
-            else if (tagName == "method")
-            {
-                ParsedMemberName parsed = parseMemberName(tagValue);
-                if (!parsed.within.empty() && doc.state.within.empty())
-                    doc.state.within = parsed.within;
-                doc.typeTags.push_back({"function", parsed.name, "", true});
-            }
-            else if (tagName == "constructor")
-            {
-                ParsedMemberName parsed = parseMemberName(tagValue);
-                if (!parsed.within.empty() && doc.state.within.empty())
-                    doc.state.within = parsed.within;
-                doc.typeTags.push_back({"constructor", parsed.name, "", false});
-            }
-            else if (tagName == "within")
-            {
-                doc.state.within = tagValue;
-            }
-            else if (tagName == "field")
-            {
-                auto [name, rest] = splitTagValue(tagValue);
-                bool hasSeparator = rest.find("--") != std::string::npos;
-                auto [typePart, description] = parseTypeAndDescription(rest);
-                doc.fields.push_back({name, typePart, description});
-                if (hasSeparator)
-                    continuation.description = &doc.fields.back().description;
-                else if (!doc.fields.back().type.empty())
-                    continuation.type = &doc.fields.back().type;
-            }
-            else if (tagName == "param")
-            {
-                auto [name, rest] = splitTagValue(tagValue);
-                bool hasSeparator = rest.find("--") != std::string::npos;
-                auto [typePart, description] = parseTypeAndDescription(rest);
-                ParamInfo param;
-                param.name = name;
-                param.type = typePart;
-                if (!description.empty())
-                    param.description.push_back(description);
-                doc.params.push_back(param);
-                if (hasSeparator)
-                    continuation.description = &doc.params.back().description;
-                else if (!doc.params.back().type.empty())
-                    continuation.type = &doc.params.back().type;
-            }
-            else if (tagName == "return")
-            {
-                bool hasSeparator = tagValue.find("--") != std::string::npos;
-                auto [typePart, description] = parseTypeAndDescription(tagValue);
-                ReturnInfo ret;
-                ret.type = typePart;
-                if (!description.empty())
-                    ret.description.push_back(description);
-                doc.returns.push_back(ret);
-                if (hasSeparator)
-                    continuation.description = &doc.returns.back().description;
-                else if (!doc.returns.back().type.empty())
-                    continuation.type = &doc.returns.back().type;
-            }
-            else if (tagName == "error")
-            {
-                bool hasSeparator = tagValue.find("--") != std::string::npos;
-                auto [typePart, description] = parseTypeAndDescription(tagValue);
-                ErrorInfo err;
-                err.type = typePart;
-                if (!description.empty())
-                    err.description.push_back(description);
-                doc.errors.push_back(err);
-                if (hasSeparator)
-                    continuation.description = &doc.errors.back().description;
-                else if (!doc.errors.back().type.empty())
-                    continuation.type = &doc.errors.back().type;
-            }
-            else if (tagName == "yields")
-            {
-                doc.state.yields = true;
-            }
-            else if (tagName == "tag")
-            {
-                if (!tagValue.empty())
-                    doc.state.tags.push_back(tagValue);
-            }
-            else if (tagName == "category")
-            {
-                if (!tagValue.empty())
-                    doc.state.categories.push_back(tagValue);
-            }
-            else if (tagName == "event")
-            {
-                doc.state.event = true;
-            }
-            else if (tagName == "extends")
-            {
-                if (!tagValue.empty())
-                    doc.state.extends.push_back(tagValue);
-            }            else if (tagName == "unreleased")
-            {
-                doc.state.unreleased = true;
-            }
-            else if (tagName == "since")
-            {
-                doc.state.since = tagValue;
-            }
-            else if (tagName == "deprecated")
-            {
-                auto [version, description] = parseTypeAndDescription(tagValue);
-                doc.state.deprecatedVersion = version;
-                doc.state.deprecatedDescription = description;
-            }
-            else if (tagName == "server" || tagName == "client" || tagName == "plugin")
-            {
-                doc.state.realms.push_back(tagName);
-            }
-            else if (tagName == "private")
-            {
-                doc.state.visibility = "private";
-            }
-            else if (tagName == "ignore")
-            {
-                doc.state.visibility = "ignored";
-            }
-            else if (tagName == "readonly")
-            {
-                doc.state.readonly = true;
-            }
-            else if (tagName == "__index")
-            {
-                doc.state.indexName = tagValue;
-            }
-            else if (tagName == "external")
-            {
-                auto [name, rest] = splitTagValue(tagValue);
-                if (!name.empty() && !rest.empty())
-                    doc.externals.push_back({name, rest});
-            }
-            else if (tagName == "inheritDoc")
-            {
-                doc.state.inheritDoc = tagValue;
-            }
-            else if (tagName == "include")
-            {
-                if (!tagValue.empty())
-                    doc.state.includes.push_back(tagValue);
-            }
-            else if (tagName == "snippet")
+static void parsePropTag(ParsedDoc& doc, const TagLine& tag, ContinuationState& continuation)
+{
+    auto [rawName, rest] = splitTagValue(tag.value);
+    ParsedMemberName parsed = parseMemberName(rawName);
+    setWithinFromMember(doc, parsed);
+    doc.typeTags.push_back({"property", parsed.name, std::string(rest), false});
+    if (!rest.empty() && rest.find("--") == std::string_view::npos)
+        continuation.text = &doc.typeTags.back().type;
+}
+
+static void parseTypeTag(ParsedDoc& doc, const TagLine& tag, ContinuationState& continuation)
+{
+    auto [name, rest] = splitTagValue(tag.value);
+    doc.typeTags.push_back({"type", std::string(name), std::string(rest), false});
+    if (!rest.empty() && rest.find("--") == std::string_view::npos)
+        continuation.text = &doc.typeTags.back().type;
+}
+
+static void parseInterfaceTag(ParsedDoc& doc, const TagLine& tag, ContinuationState&)
+{
+    doc.typeTags.push_back({"interface", std::string(tag.value), "", false});
+}
+
+static void parseFunctionTag(ParsedDoc& doc, const TagLine& tag, ContinuationState&)
+{
+    ParsedMemberName parsed = parseMemberName(tag.value);
+    setWithinFromMember(doc, parsed);
+    doc.typeTags.push_back({"function", parsed.name, "", parsed.isMethod});
+}
+
+static void parseMethodTag(ParsedDoc& doc, const TagLine& tag, ContinuationState&)
+{
+    ParsedMemberName parsed = parseMemberName(tag.value);
+    setWithinFromMember(doc, parsed);
+    doc.typeTags.push_back({"function", parsed.name, "", true});
+}
+
+static void parseConstructorTag(ParsedDoc& doc, const TagLine& tag, ContinuationState&)
+{
+    ParsedMemberName parsed = parseMemberName(tag.value);
+    setWithinFromMember(doc, parsed);
+    doc.typeTags.push_back({"constructor", parsed.name, "", false});
+}
+
+static void parseFieldTag(ParsedDoc& doc, const TagLine& tag, ContinuationState& continuation)
+{
+    auto [name, rest] = splitTagValue(tag.value);
+    bool hasSeparator = rest.find("--") != std::string_view::npos;
+    auto [typePart, description] = parseTypeAndDescription(rest);
+    doc.fields.push_back({std::string(name), typePart, description});
+    if (hasSeparator)
+        continuation.text = &doc.fields.back().description;
+    else if (!doc.fields.back().type.empty())
+        continuation.text = &doc.fields.back().type;
+}
+
+static void parseParamTag(ParsedDoc& doc, const TagLine& tag, ContinuationState& continuation)
+{
+    auto [name, rest] = splitTagValue(tag.value);
+    bool hasSeparator = rest.find("--") != std::string_view::npos;
+    auto [typePart, description] = parseTypeAndDescription(rest);
+    ParamInfo param;
+    param.name = name;
+    param.type = typePart;
+    if (!description.empty())
+        param.description.push_back(description);
+    doc.params.push_back(param);
+    if (hasSeparator)
+        continuation.lines = &doc.params.back().description;
+    else if (!doc.params.back().type.empty())
+        continuation.text = &doc.params.back().type;
+}
+
+// @return, @error: '타입 -- 설명'
+template<typename Info, std::vector<Info> ParsedDoc::*List>
+static void parseTypedDescriptionTag(ParsedDoc& doc, const TagLine& tag, ContinuationState& continuation)
+{
+    bool hasSeparator = tag.value.find("--") != std::string_view::npos;
+    auto [typePart, description] = parseTypeAndDescription(tag.value);
+    Info info;
+    info.type = typePart;
+    if (!description.empty())
+        info.description.push_back(description);
+    (doc.*List).push_back(info);
+    if (hasSeparator)
+        continuation.lines = &(doc.*List).back().description;
+    else if (!(doc.*List).back().type.empty())
+        continuation.text = &(doc.*List).back().type;
+}
+
+template<bool DocState::*Flag>
+static void setStateFlag(ParsedDoc& doc, const TagLine&, ContinuationState&)
+{
+    doc.state.*Flag = true;
+}
+
+template<std::string DocState::*Value>
+static void setStateValue(ParsedDoc& doc, const TagLine& tag, ContinuationState&)
+{
+    doc.state.*Value = tag.value;
+}
+
+// 값이 비어 있으면 무시한다.
+template<std::vector<std::string> DocState::*List>
+static void appendStateValue(ParsedDoc& doc, const TagLine& tag, ContinuationState&)
+{
+    if (!tag.value.empty())
+        (doc.state.*List).emplace_back(tag.value);
+}
+
+static void parseDeprecatedTag(ParsedDoc& doc, const TagLine& tag, ContinuationState&)
+{
+    auto [version, description] = parseTypeAndDescription(tag.value);
+    doc.state.deprecatedVersion = version;
+    doc.state.deprecatedDescription = description;
+}
+
+static void parseRealmTag(ParsedDoc& doc, const TagLine& tag, ContinuationState&)
+{
+    doc.state.realms.emplace_back(tag.name);
+}
+
+static void parsePrivateTag(ParsedDoc& doc, const TagLine&, ContinuationState&)
+{
+    doc.state.visibility = "private";
+}
+
+static void parseIgnoreTag(ParsedDoc& doc, const TagLine&, ContinuationState&)
+{
+    doc.state.visibility = "ignored";
+}
+
+static void parseExternalTag(ParsedDoc& doc, const TagLine& tag, ContinuationState&)
+{
+    auto [name, rest] = splitTagValue(tag.value);
+    if (!name.empty() && !rest.empty())
+        doc.externals.emplace_back(std::string(name), std::string(rest));
+}
+
+struct TagEntry
+{
+    std::string_view name;
+    TagHandler handler;
+};
+
+// 태그를 추가하려면 여기에 한 줄을 넣는다. 목록에 없는 태그는 무시한다.
+static constexpr TagEntry kDocTags[] = {
+    {"class", &parseClassTag},
+    {"prop", &parsePropTag},
+    {"type", &parseTypeTag},
+    {"interface", &parseInterfaceTag},
+    {"function", &parseFunctionTag},
+    {"method", &parseMethodTag},
+    {"constructor", &parseConstructorTag},
+    {"within", &setStateValue<&DocState::within>},
+    {"field", &parseFieldTag},
+    {"param", &parseParamTag},
+    {"return", &parseTypedDescriptionTag<ReturnInfo, &ParsedDoc::returns>},
+    {"error", &parseTypedDescriptionTag<ErrorInfo, &ParsedDoc::errors>},
+    {"yields", &setStateFlag<&DocState::yields>},
+    {"tag", &appendStateValue<&DocState::tags>},
+    {"category", &appendStateValue<&DocState::categories>},
+    {"event", &setStateFlag<&DocState::event>},
+    {"extends", &appendStateValue<&DocState::extends>},
+    {"unreleased", &setStateFlag<&DocState::unreleased>},
+    {"since", &setStateValue<&DocState::since>},
+    {"deprecated", &parseDeprecatedTag},
+    {"server", &parseRealmTag},
+    {"client", &parseRealmTag},
+    {"plugin", &parseRealmTag},
+    {"private", &parsePrivateTag},
+    {"ignore", &parseIgnoreTag},
+    {"readonly", &setStateFlag<&DocState::readonly>},
+    {"__index", &setStateValue<&DocState::indexName>},
+    {"external", &parseExternalTag},
+    {"inheritDoc", &setStateValue<&DocState::inheritDoc>},
+    {"include", &appendStateValue<&DocState::includes>},
+    {"snippet", &appendStateValue<&DocState::snippets>},
+    {"alias", &appendStateValue<&DocState::aliases>},
+};
+
+constexpr size_t kDocTagSlots = 256;
+
+constexpr uint32_t docTagHash(std::string_view name, uint32_t seed)
+{
+    uint32_t hash = seed;
+    for (char ch : name)
+    {
+        hash ^= static_cast<unsigned char>(ch);
+        hash *= 16777619u;
+    }
+    hash ^= hash >> 15;
+    hash *= 0x2c1b3c6du;
+    hash ^= hash >> 12;
+    return hash;
+}
+
+struct DocTagTable
+{
+    uint32_t seed = 0;
+    std::array<uint8_t, kDocTagSlots> slots{};
+};
+
+// kDocTags가 서로 다른 슬롯에 들어가는 시드를 컴파일 시간에 찾는다. 슬롯 값은 항목 번호 + 1, 0은 빈 슬롯이다.
+constexpr DocTagTable buildDocTagTable()
+{
+    static_assert(std::size(kDocTags) < 255, "kDocTags does not fit in uint8_t slots");
+
+    for (uint32_t seed = 2166136261u;; ++seed)
+    {
+        DocTagTable table;
+        table.seed = seed;
+        bool collided = false;
+        for (size_t i = 0; i < std::size(kDocTags) && !collided; ++i)
+        {
+            uint8_t& slot = table.slots[docTagHash(kDocTags[i].name, seed) % kDocTagSlots];
+            if (slot != 0)
+                collided = true;
+            else
+                slot = static_cast<uint8_t>(i + 1);
+        }
+
+        if (!collided)
+            return table;
+    }
+}
+
+static constexpr DocTagTable kDocTagTable = buildDocTagTable();
+
+static TagHandler findDocTagHandler(std::string_view name)
+{
+    uint8_t slot = kDocTagTable.slots[docTagHash(name, kDocTagTable.seed) % kDocTagSlots];
+    if (slot == 0 || kDocTags[slot - 1].name != name)
+        return nullptr;
+    return kDocTags[slot - 1].handler;
+}
+
+static bool isContinuationIndent(std::string_view indent)
+{
+    return !indent.empty() && (indent.find('\t') != std::string_view::npos || indent.size() >= 2);
+}
+
+static ParsedDoc parseDocBlock(const std::vector<std::string>& contentLines)
+{
+    ParsedDoc doc;
+    std::vector<std::string> lines = dedentLines(contentLines);
+    bool inFence = false;
+    ContinuationState continuation;
+
+    for (const std::string& line : lines)
+    {
+        std::string_view trimmed = trimView(line);
+
+        if (trimmed.compare(0, 3, "```") == 0)
+            inFence = !inFence;
+
+        size_t indentSize = line.find_first_not_of(" \t");
+        if (indentSize == std::string::npos)
+            indentSize = line.size();
+        std::string_view afterIndent = std::string_view(line).substr(indentSize);
+        std::string_view continued = trimView(afterIndent);
+        bool isContinuation = continuation && isContinuationIndent(std::string_view(line).substr(0, indentSize))
+            && !(continued.compare(0, 1, "@") == 0 || continued.compare(0, 1, ".") == 0);
+
+        if (!inFence && isContinuation)
+        {
+            continuation.append(trimRight(std::string(afterIndent)));
+            continue;
+        }
+
+        continuation = ContinuationState();
+
+        if (!inFence && trimmed.compare(0, 1, "@") == 0)
+        {
+            std::string_view tagLine = trimmed.substr(1);
+            TagLine tag;
+            size_t space = tagLine.find_first_of(" \t");
+            if (space == std::string_view::npos)
             {
-                if (!tagValue.empty())
-                    doc.state.snippets.push_back(tagValue);
+                tag.name = tagLine;
             }
-            else if (tagName == "alias")
+            else
             {
-                if (!tagValue.empty())
-                    doc.state.aliases.push_back(tagValue);
+                tag.name = tagLine.substr(0, space);
+                tag.value = trimView(tagLine.substr(space + 1));
             }
+
+            if (TagHandler handler = findDocTagHandler(tag.name))
+                handler(doc, tag, continuation);
             continue;
         }
 
-        if (!inFence && trimmed.rfind(".", 0) == 0)
+        if (!inFence && trimmed.compare(0, 1, ".") == 0)
         {
-            std::string fieldLine = trim(trimmed.substr(1));
+            std::string_view fieldLine = trimView(trimmed.substr(1));
             auto [name, rest] = splitTagValue(fieldLine);
             auto [typePart, description] = parseTypeAndDescription(rest);
-            doc.fields.push_back({name, typePart, description});
+            doc.fields.push_back({std::string(name), typePart, description});
             continue;
         }
 
@@ -694,72 +1214,126 @@ static ParsedDoc parseDocBlock(const std::vector<std::string>& contentLines)
     }
 
     return doc;
+}
+
+enum class InlineLineKind : uint8_t
+{
+    Blank,
+    DocComment,
+    BlockClose,
+    Code,
+};
+
+struct InlineDocLine
+{
+    InlineLineKind kind = InlineLineKind::Code;
+    // 이 줄까지(포함) 마지막으로 비어 있지 않은 줄. 없으면 -1
+    int lastContent = -1;
+    // DocComment 줄이면 이어지는 "---" 줄의 첫 줄
+    int runStart = -1;
+    // 이 줄까지(포함) 마지막으로 "--[=["가 있는 줄. 없으면 -1
+    int lastBlockOpen = -1;
+};
+
+// 타입 테이블 필드 문서를 찾을 때 줄마다 뒤로 훑지 않도록 소스를 한 번 앞으로 훑어 분류해 둔다.
+static std::vector<InlineDocLine> buildInlineDocIndex(const Source& source)
+{
+    std::vector<InlineDocLine> index(source.lineCount());
+    int lastContent = -1;
+    int lastBlockOpen = -1;
+
+    for (size_t i = 0; i < index.size(); ++i)
+    {
+        std::string_view line = source.line(i);
+        InlineDocLine& entry = index[i];
+        int lineIndex = static_cast<int>(i);
+
+        if (isBlankLine(line))
+        {
+            entry.kind = InlineLineKind::Blank;
+        }
+        else
+        {
+            lastContent = lineIndex;
+            bool dashes = source.lineHasDashes[i];
+            if (dashes && startsAfterIndent(line, "---"))
+            {
+                entry.kind = InlineLineKind::DocComment;
+                entry.runStart = i > 0 && index[i - 1].kind == InlineLineKind::DocComment ? index[i - 1].runStart : lineIndex;
+            }
+            else if (line.find("]=]") != std::string_view::npos)
+            {
+                entry.kind = InlineLineKind::BlockClose;
+            }
+
+            if (dashes && line.find("--[=[") != std::string_view::npos)
+                lastBlockOpen = lineIndex;
+        }
 
-static std::vector<std::string> collectInlineDocLines(const Source& source, int startLine, int targetLine)
+        entry.lastContent = lastContent;
+        entry.lastBlockOpen = lastBlockOpen;
+    }
+
+    return index;
+}
+
+// targetLine 바로 위의 주석 묶음을 돌려준다. startLine(타입 테이블 시작) 위로는 올라가지 않는다.
+static std::vector<std::string> collectInlineDocLines(
+    const Source& source,
+    const std::vector<InlineDocLine>& inlineIndex,
+    int startLine,
+    int targetLine
+)
 {
     std::vector<std::string> lines;
     if (targetLine <= 1)
         return lines;
 
-    int index = targetLine - 2;
     int minIndex = std::max(0, startLine - 1);
-
-    while (index >= minIndex && trim(source.lines[index]).empty())
-        index--;
-
+    int index = inlineIndex[targetLine - 2].lastContent;
     if (index < minIndex)
         return lines;
 
-    std::string trimmed = trim(source.lines[index]);
+    const InlineDocLine& current = inlineIndex[index];
 
-    if (trimmed.rfind("---", 0) == 0)
+    if (current.kind == InlineLineKind::DocComment)
     {
-        int end = index;
-        while (index >= minIndex && trim(source.lines[index]).rfind("---", 0) == 0)
-            index--;
-
-        for (int lineIndex = index + 1; lineIndex <= end; ++lineIndex)
+        for (int lineIndex = std::max(current.runStart, minIndex); lineIndex <= index; ++lineIndex)
         {
-            std::string raw = source.lines[lineIndex];
+            std::string_view raw = source.line(lineIndex);
             size_t pos = raw.find("---");
-            std::string content = pos == std::string::npos ? raw : raw.substr(pos + 3);
+            std::string_view content = pos == std::string_view::npos ? raw : raw.substr(pos + 3);
             if (!content.empty() && content.front() == ' ')
-                content.erase(content.begin());
-            lines.push_back(content);
+                content.remove_prefix(1);
+            lines.emplace_back(content);
         }
         return lines;
     }
 
-    if (trimmed.find("]=]") != std::string::npos)
+    if (current.kind == InlineLineKind::BlockClose)
     {
         int end = index;
-        while (index >= minIndex)
-        {
-            if (source.lines[index].find("--[=[") != std::string::npos)
-                break;
-            index--;
-        }
-
+        index = current.lastBlockOpen;
         if (index < minIndex)
             return lines;
 
-        size_t startPos = source.lines[index].find("--[=[");
-        std::string first = startPos == std::string::npos ? source.lines[index] : source.lines[index].substr(startPos + 5);
+        std::string_view opening = source.line(index);
+        size_t startPos = opening.find("--[=[");
+        std::string_view first = startPos == std::string_view::npos ? opening : opening.substr(startPos + 5);
         if (!first.empty())
-            lines.push_back(first);
+            lines.emplace_back(first);
 
         for (int lineIndex = index + 1; lineIndex <= end; ++lineIndex)
         {
-            std::string current = source.lines[lineIndex];
-            size_t endPos = current.find("]=]");
-            if (endPos != std::string::npos)
+            std::string_view line = source.line(lineIndex);
+            size_t endPos = line.find("]=]");
+            if (endPos != std::string_view::npos)
             {
-                std::string beforeEnd = current.substr(0, endPos);
-                if (!beforeEnd.empty())
-                    lines.push_back(beforeEnd);
+                if (endPos > 0)
+                    lines.emplace_back(line.substr(0, endPos));
                 break;
             }
-            lines.push_back(current);
+            lines.emplace_back(line);
         }
     }
 
@@ -785,7 +1359,13 @@ static std::string joinInlineDescription(const std::vector<std::string>& lines)
     return trimRight(out.str());
 }
 
-static std::vector<FieldInfo> collectTypeTableFields(const Source& source, const Luau::AstTypeTable* table)
+static std::string extractLocationText(const Source& source, const Luau::Location& location);
+
+static std::vector<FieldInfo> collectTypeTableFields(
+    const Source& source,
+    const std::vector<InlineDocLine>& inlineIndex,
+    const Luau::AstTypeTable* table
+)
 {
     std::vector<FieldInfo> fields;
     if (!table)
@@ -804,7 +1384,7 @@ static std::vector<FieldInfo> collectTypeTableFields(const Source& source, const
         if (prop.type)
             field.type = extractLocationText(source, prop.type->location);
 
-        std::vector<std::string> docLines = collectInlineDocLines(source, startLine, field.line);
+        std::vector<std::string> docLines = collectInlineDocLines(source, inlineIndex, startLine, field.line);
         field.description = joinInlineDescription(docLines);
 
         if (field.line >= startLine && field.line <= endLine)
@@ -813,7 +1393,6 @@ static std::vector<FieldInfo> collectTypeTableFields(const Source& source, const
 
     return fields;
 }
-}
 
 static std::string joinDescription(const std::vector<std::string>& lines, std::string& summaryOut)
 {
@@ -934,6 +1513,8 @@ struct BindingCollector : Luau::AstVisitor
 {
     const Source& source;
     std::vector<Binding>& bindings;
+    // 첫 타입 테이블을 만날 때 만든다. 타입 테이블이 없는 파일은 만들지 않는다.
+    std::optional<std::vector<InlineDocLine>> inlineIndex;
 
     BindingCollector(const Source& source, std::vector<Binding>& bindings)
         : source(source)
@@ -1077,7 +1658,9 @@ struct BindingCollector : Luau::AstVisitor
 
         if (auto table = node->type ? node->type->as<Luau::AstTypeTable>() : nullptr)
         {
-            binding.typeFields = collectTypeTableFields(source, table);
+            if (!inlineIndex)
+                inlineIndex = buildInlineDocIndex(source);
+            binding.typeFields = collectTypeTableFields(source, *inlineIndex, table);
             binding.typeTableStartLine = static_cast<int>(table->location.begin.line) + 1;
             binding.typeTableEndLine = static_cast<int>(table->location.end.line) + 1;
         }
@@ -1132,11 +1715,11 @@ static std::string buildQualifiedName(const std::string& within, const std::stri
     return isMethod ? within + ":" + name : within + "." + name;
 }
 
-static int findColumn(const std::vector<std::string>& lines, int lineNumber)
+static int findColumn(const Source& source, int lineNumber)
 {
-    if (lineNumber <= 0 || static_cast<size_t>(lineNumber) > lines.size())
+    if (lineNumber <= 0 || static_cast<size_t>(lineNumber) > source.lineCount())
         return 1;
-    const std::string& line = lines[lineNumber - 1];
+    std::string_view line = source.line(lineNumber - 1);
     size_t pos = line.find_first_not_of(" \t");
     return pos == std::string::npos ? 1 : static_cast<int>(pos) + 1;
 }
@@ -1145,19 +1728,30 @@ struct ModuleContext
 {
     fs::path filePath;
     fs::path baseDir;
+    // Frontend와 리졸버가 쓰는 이름. 루트가 하나면 moduleId와 같고,
+    // 여러 루트를 같이 분석하면 작업 공간 기준 경로라 패키지끼리 겹치지 않는다.
     std::string moduleName;
+    // 출력 JSON의 모듈 id (baseDir 기준 경로)
+    std::string moduleId;
+    // 'Shared.Util'처럼 기준 디렉터리에서 찾는 require의 접두사. 루트가 하나면 비어 있다.
+    std::string requireBase;
     std::string rootRelativePath;
     std::string baseRelativePath;
     Source source;
     std::vector<DocBlock> blocks;
     std::vector<Binding> bindings;
+    // typesDir 파일. 모듈로 검사하지 않고 정의 파일로 전역 환경에 올린다.
+    bool definition = false;
 };
 
+struct TypeDisplayCache;
+
 struct ModuleAnalysis
 {
     std::string moduleName;
     Luau::ModulePtr module;
     Luau::ScopePtr scope;
+    TypeDisplayCache* displayCache = nullptr;
 };
 
 static bool pathStartsWith(const fs::path& path, const fs::path& prefix)
@@ -1198,22 +1792,51 @@ static std::string stripExtension(const fs::path& path)
     return normalizePath(withoutExt);
 }
 
-static ModuleContext buildModuleContext(const fs::path& filePath, const GeneratorOptions& options)
+static ModuleContext buildModuleContext(const fs::path& filePath, Source source, const GeneratorOptions& options)
 {
     ModuleContext context;
     context.filePath = filePath;
-    context.source = loadSource(filePath);
-    context.blocks = extractDocBlocks(context.source.lines);
-    context.bindings = collectBindings(context.source);
+    context.source = std::move(source);
+
+    {
+        DOCGEN_TRACE_SCOPE("extractDocBlocks", normalizePath(filePath));
+        context.blocks = extractDocBlocks(context.source);
+    }
+
+    {
+        DOCGEN_TRACE_SCOPE("collectBindings", normalizePath(filePath));
+        context.bindings = collectBindings(context.source);
+    }
 
     context.baseDir = selectBaseDir(filePath, options);
     context.rootRelativePath = normalizePath(fs::relative(filePath, options.rootDir));
     context.baseRelativePath = normalizePath(fs::relative(filePath, context.baseDir));
     context.moduleName = stripExtension(fs::relative(filePath, context.baseDir));
+    context.moduleId = context.moduleName;
+    context.definition = !options.typesDir.empty() && context.baseDir == options.typesDir;
 
     return context;
 }
 
+// 여러 루트를 하나의 Frontend로 분석할 때는 모듈 이름을 작업 공간 기준 경로로 바꾼다.
+// 상대 require는 파일 시스템 경로대로 풀리므로 패키지 사이의 '../../other/src/Util'도 같은 모듈을 가리킨다.
+static void useWorkspaceModuleName(ModuleContext& context, const fs::path& workspaceDir)
+{
+    context.moduleName = stripExtension(fs::relative(context.filePath, workspaceDir));
+    std::string base = normalizePath(fs::relative(context.baseDir, workspaceDir));
+    context.requireBase = base == "." ? "" : base;
+}
+
+static ModuleContext buildModuleContext(const fs::path& filePath, const GeneratorOptions& options)
+{
+    Source source;
+    {
+        DOCGEN_TRACE_SCOPE("loadSource", normalizePath(filePath));
+        source = loadSource(filePath);
+    }
+    return buildModuleContext(filePath, std::move(source), options);
+}
+
 static std::optional<std::string> readFileText(const fs::path& filePath)
 {
     std::ifstream file(filePath, std::ios::binary);
@@ -1237,54 +1860,111 @@ static std::string safeRelativePath(const fs::path& path, const fs::path& rootDi
     }
 }
 
+// Frontend가 여러 스레드에서 getConfig를 호출해도 안전하도록 디렉터리 단위 캐시를 샤딩한다.
+// 디렉터리마다 설정을 정확히 한 번만 읽고, 설정 파일이 없는 디렉터리도 상속 결과를 그대로 캐시한다.
 struct DocgenConfigResolver : Luau::ConfigResolver
 {
+    struct ConfigEntry
+    {
+        std::once_flag once;
+        Luau::Config config;
+    };
+
+    struct ConfigShard
+    {
+        std::mutex mutex;
+        std::unordered_map<std::string, std::unique_ptr<ConfigEntry>> entries;
+    };
+
+    static constexpr size_t kShardCount = 16;
+
+    // dir: 설정을 찾기 시작할 디렉터리, rootDir: 그 모듈 패키지의 루트. 설정 파일 진단 경로는 패키지 루트 기준이다.
+    struct ModuleConfigDir
+    {
+        std::string dir;
+        fs::path rootDir;
+    };
+
     Luau::Config defaultConfig;
-    fs::path rootDir;
 
-    std::unordered_map<std::string, fs::path> modulePaths;
+    std::unordered_map<std::string, ModuleConfigDir> moduleDirs;
 
-    mutable std::unordered_map<std::string, Luau::Config> configCache;
+    mutable std::array<ConfigShard, kShardCount> shards;
+    mutable std::mutex diagnosticsMutex;
     mutable std::vector<Diagnostic> diagnostics;
 
-    DocgenConfigResolver(const fs::path& rootDir, const std::unordered_map<std::string, fs::path>& modulePaths)
-        : rootDir(rootDir)
-        , modulePaths(modulePaths)
+    // 여러 패키지를 같이 분석해도 모듈마다 자기 패키지 루트를 쓰므로 따로 실행했을 때와 같다.
+    void registerModule(const std::string& moduleName, const fs::path& filePath, const fs::path& rootDir)
     {
+        moduleDirs[moduleName] = {directoryKey(filePath.parent_path()), rootDir};
+    }
+
+    void unregisterModule(const std::string& moduleName)
+    {
+        moduleDirs.erase(moduleName);
+    }
+
+    static std::string directoryKey(const fs::path& dir)
+    {
+        std::error_code error;
+        fs::path absolute = fs::absolute(dir, error);
+        return normalizePath(error ? dir : absolute);
     }
 
     const Luau::Config& getConfig(const Luau::ModuleName& name, const Luau::TypeCheckLimits&) const override
     {
-        auto it = modulePaths.find(name);
-        if (it == modulePaths.end())
+        auto it = moduleDirs.find(name);
+        if (it == moduleDirs.end())
             return defaultConfig;
 
-        fs::path dir = it->second.parent_path();
-        return readConfigRecursive(dir);
+        return readConfigRecursive(it->second.dir, it->second.rootDir);
+    }
+
+    ConfigEntry& acquireEntry(const std::string& key) const
+    {
+        ConfigShard& shard = shards[std::hash<std::string>()(key) % kShardCount];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        std::unique_ptr<ConfigEntry>& entry = shard.entries[key];
+        if (!entry)
+            entry = std::make_unique<ConfigEntry>();
+        return *entry;
+    }
+
+    // 디렉터리마다 한 번만 읽으므로 여러 패키지가 같이 쓰는 상위 설정의 진단은 처음 읽은 모듈의 패키지 루트 기준이다.
+    const Luau::Config& readConfigRecursive(const std::string& key, const fs::path& rootDir) const
+    {
+        ConfigEntry& entry = acquireEntry(key);
+        std::call_once(entry.once, [&]() {
+            entry.config = loadDirectoryConfig(fs::path(key), rootDir);
+        });
+        return entry.config;
     }
 
-    const Luau::Config& readConfigRecursive(const fs::path& dir) const
+    void pushDiagnostic(Diagnostic diagnostic) const
     {
-        std::string key = normalizePath(dir);
-        auto cached = configCache.find(key);
-        if (cached != configCache.end())
-            return cached->second;
+        std::lock_guard<std::mutex> lock(diagnosticsMutex);
+        diagnostics.push_back(std::move(diagnostic));
+    }
 
+    Luau::Config loadDirectoryConfig(const fs::path& dir, const fs::path& rootDir) const
+    {
         Luau::Config result = defaultConfig;
 
         fs::path parent = dir.parent_path();
         if (!parent.empty() && parent != dir)
-            result = readConfigRecursive(parent);
+            result = readConfigRecursive(normalizePath(parent), rootDir);
 
         fs::path luaurcPath = dir / Luau::kConfigName;
         fs::path luauConfigPath = dir / Luau::kLuauConfigName;
 
-        bool hasLuaurc = fs::is_regular_file(luaurcPath);
-        bool hasLuauConfig = fs::is_regular_file(luauConfigPath);
+        std::error_code error;
+        bool hasLuaurc = fs::is_regular_file(luaurcPath, error);
+        bool hasLuauConfig = fs::is_regular_file(luauConfigPath, error);
 
         if (hasLuaurc && hasLuauConfig)
         {
-            diagnostics.push_back({
+            pushDiagnostic({
                 "warning",
                 safeRelativePath(luaurcPath, rootDir),
                 1,
@@ -1303,13 +1983,13 @@ struct DocgenConfigResolver : Luau::ConfigResolver
                 Luau::ConfigOptions options;
                 options.aliasOptions = aliasOptions;
 
-                if (auto error = Luau::parseConfig(*contents, result, options))
+                if (auto parseError = Luau::parseConfig(*contents, result, options))
                 {
-                    diagnostics.push_back({
+                    pushDiagnostic({
                         "warning",
                         safeRelativePath(luaurcPath, rootDir),
                         1,
-                        *error,
+                        *parseError,
                     });
                 }
             }
@@ -1323,25 +2003,25 @@ struct DocgenConfigResolver : Luau::ConfigResolver
                 aliasOptions.overwriteAliases = true;
 
                 Luau::InterruptCallbacks callbacks;
-                if (auto error = Luau::extractLuauConfig(*contents, result, aliasOptions, std::move(callbacks)))
+                if (auto parseError = Luau::extractLuauConfig(*contents, result, aliasOptions, std::move(callbacks)))
                 {
-                    diagnostics.push_back({
+                    pushDiagnostic({
                         "warning",
                         safeRelativePath(luauConfigPath, rootDir),
                         1,
-                        *error,
+                        *parseError,
                     });
                 }
             }
         }
 
-        auto inserted = configCache.emplace(key, std::move(result));
-        return inserted.first->second;
+        return result;
     }
 
     std::vector<Diagnostic> consumeDiagnostics() const
     {
-        std::vector<Diagnostic> result = diagnostics;
+        std::lock_guard<std::mutex> lock(diagnosticsMutex);
+        std::vector<Diagnostic> result = std::move(diagnostics);
         diagnostics.clear();
         return result;
     }
@@ -1371,26 +2051,214 @@ static std::string stripRequireExtension(const std::string& value)
     return value;
 }
 
-struct DocgenFileResolver : Luau::FileResolver
+static std::string moduleDirectory(const std::string& moduleName)
 {
-    std::unordered_map<std::string, const ModuleContext*> modulesByName;
+    size_t slash = moduleName.rfind('/');
+    return slash == std::string::npos ? "" : moduleName.substr(0, slash);
+}
 
-    explicit DocgenFileResolver(const std::vector<ModuleContext>& contexts)
-    {
-        for (const ModuleContext& context : contexts)
-            modulesByName.emplace(context.moduleName, &context);
-    }
+// fs::path::lexically_normal과 같은 규칙으로 '/' 구분 모듈 경로를 합친다.
+// 전부 상쇄되면 "."이고, "."/".."/빈 이름으로 끝나면 끝에 '/'가 남는다. 둘 다 모듈 이름과 맞지 않는다.
+static std::string joinModulePath(const std::string& base, const std::string& relative)
+{
+    if (base.empty() && relative.empty())
+        return "";
 
-    std::optional<Luau::SourceCode> readSource(const Luau::ModuleName& name) override
-    {
-        auto it = modulesByName.find(name);
-        if (it == modulesByName.end())
-            return std::nullopt;
+    bool absolute = !relative.empty() && relative[0] == '/';
+    std::vector<std::string_view> segments;
+    bool trailingSlash = false;
 
-        Luau::SourceCode code;
-        code.source = it->second->source.content;
-        code.type = Luau::SourceCode::Module;
-        return code;
+    auto append = [&](std::string_view path) {
+        size_t start = 0;
+        while (start <= path.size())
+        {
+            size_t slash = path.find('/', start);
+            if (slash == std::string_view::npos)
+                slash = path.size();
+
+            std::string_view segment = path.substr(start, slash - start);
+            if (segment == "..")
+            {
+                if (!segments.empty() && segments.back() != "..")
+                    segments.pop_back();
+                else if (!absolute)
+                    segments.push_back(segment);
+                trailingSlash = true;
+            }
+            else if (segment.empty() || segment == ".")
+            {
+                trailingSlash = true;
+            }
+            else
+            {
+                segments.push_back(segment);
+                trailingSlash = false;
+            }
+
+            start = slash + 1;
+        }
+    };
+
+    if (!absolute)
+        append(base);
+    append(relative);
+
+    if (segments.empty())
+        return absolute ? "/" : ".";
+
+    std::string result = absolute ? "/" : "";
+    for (size_t i = 0; i < segments.size(); ++i)
+    {
+        if (i > 0)
+            result += '/';
+        result.append(segments[i].data(), segments[i].size());
+    }
+    if (trailingSlash && segments.back() != "..")
+        result += '/';
+    return result;
+}
+
+// 같은 디렉터리에서 같은 require 문자열은 항상 같은 모듈로 해석되므로 결과를 기억한다.
+struct DocgenFileResolver : Luau::FileResolver
+{
+    inline static const std::string kEmptyRequireBase;
+
+    std::unordered_map<std::string, const ModuleContext*> modulesByName;
+    std::unordered_map<std::string, std::string> moduleDirs;
+    std::unordered_map<std::string, std::string> requireBases;
+
+    std::shared_mutex requireCacheMutex;
+    std::unordered_map<std::string, std::optional<std::string>> requireCache;
+    std::atomic<size_t> requireCacheHits{0};
+    std::atomic<size_t> requireCacheMisses{0};
+
+    // 세션만 켠다. 모듈이 추가/제거될 때 결과가 바뀌는 require를 가진 모듈만 다시 검사하기 위해 기록한다.
+    bool trackRequires = false;
+    std::mutex requireLogMutex;
+    std::unordered_map<std::string, std::unordered_map<std::string, std::optional<std::string>>> requireLog;
+
+    DocgenFileResolver() = default;
+
+    // 정의 파일은 전역 환경에만 올리고 require 대상 모듈로는 등록하지 않는다.
+    explicit DocgenFileResolver(const std::vector<ModuleContext>& contexts)
+    {
+        for (const ModuleContext& context : contexts)
+        {
+            if (context.definition)
+                continue;
+
+            modulesByName.emplace(context.moduleName, &context);
+            moduleDirs.emplace(context.moduleName, moduleDirectory(context.moduleName));
+            if (!context.requireBase.empty())
+                requireBases.emplace(context.moduleName, context.requireBase);
+        }
+    }
+
+    // 모듈 집합이 바뀌면 이전에 실패했거나 다른 모듈로 풀린 require도 달라질 수 있다.
+    void registerModule(const ModuleContext& context)
+    {
+        if (!modulesByName.emplace(context.moduleName, &context).second)
+            return;
+
+        moduleDirs[context.moduleName] = moduleDirectory(context.moduleName);
+        if (!context.requireBase.empty())
+            requireBases[context.moduleName] = context.requireBase;
+        clearRequireCache();
+    }
+
+    void unregisterModule(const ModuleContext& context)
+    {
+        auto it = modulesByName.find(context.moduleName);
+        if (it == modulesByName.end() || it->second != &context)
+            return;
+
+        modulesByName.erase(it);
+        moduleDirs.erase(context.moduleName);
+        requireBases.erase(context.moduleName);
+        clearRequireCache();
+    }
+
+    void clearRequireCache()
+    {
+        std::unique_lock<std::shared_mutex> lock(requireCacheMutex);
+        requireCache.clear();
+    }
+
+    // 기록된 require를 현재 모듈 집합으로 다시 풀어, 결과가 달라진 모듈 이름을 돌려준다.
+    // 돌려준 모듈은 다시 검사되며 기록도 새로 남기므로 여기서 지운다.
+    std::vector<std::string> takeChangedRequirers()
+    {
+        std::lock_guard<std::mutex> lock(requireLogMutex);
+
+        std::vector<std::string> changed;
+        for (auto it = requireLog.begin(); it != requireLog.end();)
+        {
+            auto dirIt = moduleDirs.find(it->first);
+            if (dirIt == moduleDirs.end())
+            {
+                it = requireLog.erase(it);
+                continue;
+            }
+
+            auto baseIt = requireBases.find(it->first);
+            const std::string& requireBase = baseIt == requireBases.end() ? kEmptyRequireBase : baseIt->second;
+
+            bool differs = std::any_of(it->second.begin(), it->second.end(), [&](const auto& entry) {
+                return resolveRequirePath(dirIt->second, requireBase, entry.first) != entry.second;
+            });
+
+            if (differs)
+            {
+                changed.push_back(it->first);
+                it = requireLog.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        return changed;
+    }
+
+    std::optional<Luau::SourceCode> readSource(const Luau::ModuleName& name) override
+    {
+        auto it = modulesByName.find(name);
+        if (it == modulesByName.end())
+            return std::nullopt;
+
+        Luau::SourceCode code;
+        code.source = it->second->source.content;
+        code.type = Luau::SourceCode::Module;
+        return code;
+    }
+
+    std::optional<std::string> probeModule(const std::string& candidate) const
+    {
+        if (modulesByName.find(candidate) != modulesByName.end())
+            return candidate;
+
+        std::string initName = candidate.empty() ? "init" : candidate + "/init";
+        if (modulesByName.find(initName) != modulesByName.end())
+            return initName;
+
+        return std::nullopt;
+    }
+
+    std::optional<std::string> resolveRequirePath(
+        const std::string& currentDir,
+        const std::string& requireBase,
+        const std::string& rawPath
+    ) const
+    {
+        std::string requirePath = stripRequireExtension(normalizeRequirePath(rawPath));
+        if (requirePath.empty())
+            return std::nullopt;
+
+        if (auto resolved = probeModule(joinModulePath(currentDir, requirePath)))
+            return resolved;
+
+        return probeModule(joinModulePath(requireBase, requirePath));
     }
 
     std::optional<Luau::ModuleInfo> resolveModule(
@@ -1406,61 +2274,332 @@ struct DocgenFileResolver : Luau::FileResolver
         if (!str)
             return std::nullopt;
 
-        std::string requirePath(str->value.data, str->value.size);
-        requirePath = normalizeRequirePath(requirePath);
-        requirePath = stripRequireExtension(requirePath);
-
-        auto ctxIt = modulesByName.find(context->name);
-        if (ctxIt == modulesByName.end())
+        auto dirIt = moduleDirs.find(context->name);
+        if (dirIt == moduleDirs.end())
             return std::nullopt;
 
-        fs::path currentDir = fs::path(ctxIt->second->moduleName).parent_path();
+        // 같은 디렉터리라도 기준 디렉터리가 다른 패키지의 모듈이면 결과가 다를 수 있다.
+        auto baseIt = requireBases.find(context->name);
+        const std::string& requireBase = baseIt == requireBases.end() ? kEmptyRequireBase : baseIt->second;
+
+        std::string cacheKey = requireBase;
+        cacheKey += '\n';
+        cacheKey += dirIt->second;
+        cacheKey += '\n';
+        cacheKey.append(str->value.data, str->value.size);
 
-        auto tryResolve = [&](const fs::path& candidate) -> std::optional<Luau::ModuleInfo> {
-            std::string moduleName = normalizePath(candidate.lexically_normal());
-            if (modulesByName.find(moduleName) != modulesByName.end())
-                return Luau::ModuleInfo{moduleName, false};
+        std::optional<std::string> resolved;
+        bool cached = false;
+        {
+            std::shared_lock<std::shared_mutex> lock(requireCacheMutex);
+            auto it = requireCache.find(cacheKey);
+            if (it != requireCache.end())
+            {
+                resolved = it->second;
+                cached = true;
+            }
+        }
+
+        if (cached)
+        {
+            requireCacheHits++;
+        }
+        else
+        {
+            requireCacheMisses++;
+            resolved = resolveRequirePath(dirIt->second, requireBase, std::string(str->value.data, str->value.size));
+
+            std::unique_lock<std::shared_mutex> lock(requireCacheMutex);
+            requireCache.emplace(std::move(cacheKey), resolved);
+        }
 
-            std::string initName = moduleName + "/init";
-            if (modulesByName.find(initName) != modulesByName.end())
-                return Luau::ModuleInfo{initName, false};
+        if (trackRequires)
+        {
+            std::lock_guard<std::mutex> lock(requireLogMutex);
+            requireLog[context->name][std::string(str->value.data, str->value.size)] = resolved;
+        }
 
+        if (!resolved)
             return std::nullopt;
+
+        return Luau::ModuleInfo{*resolved, false};
+    }
+};
+
+// Luau는 applyInternalLimitScaling이 켜진 Frontend에서 모듈마다 SourceNode 배율을 전역 기본값에 곱해
+// TypeCheckLimits의 instantiationChildLimit / unifierIterationLimit을 만든다. 전역 플래그는 읽기만 하므로
+// 같은 프로세스의 다른 실행이나 세션과 섞이지 않는다. 배율이 하나뿐이라 두 상한을 모두 주면 더 낮은 비율이
+// 둘 다에 적용되고, 한쪽만 주면 다른 쪽도 같은 비율로 줄어든다. 두 옵션 모두 상한으로만 보장된다.
+static std::optional<double> checkLimitScale(const GeneratorOptions& options)
+{
+    std::optional<double> scale;
+    auto tighten = [&](std::optional<int> limit, int defaultLimit) {
+        if (!limit || defaultLimit <= 0)
+            return;
+
+        // Luau가 int로 자르므로 0.5를 더해 정확히 limit이 나오게 한다.
+        double ratio = (double(*limit) + 0.5) / double(defaultLimit);
+        scale = scale ? std::min(*scale, ratio) : ratio;
+    };
+
+    tighten(options.instantiationLimit, FInt::LuauTarjanChildLimit.value);
+    tighten(options.unifierIterationLimit, FInt::LuauTypeInferIterationLimit.value);
+    return scale;
+}
+
+// 검사할 모듈과 그 require를 먼저 파싱해 SourceNode를 만든 뒤 배율을 건다.
+// 세션은 generate 사이에 새로 생긴 SourceNode가 있으므로 다시 검사하기 전에 다시 건다.
+static void applyCheckLimits(Luau::Frontend& frontend, const std::vector<std::string>& moduleNames, std::optional<double> scale)
+{
+    if (!scale)
+        return;
+
+    for (const std::string& moduleName : moduleNames)
+        frontend.parse(moduleName);
+
+    for (auto& [name, node] : frontend.sourceNodes)
+    {
+        if (node)
+            node->autocompleteLimitsMult = *scale;
+    }
+}
+
+static std::optional<std::string> findExceededBudget(const Luau::ModulePtr& module)
+{
+    if (module->timeout)
+        return std::string("time limit");
+
+    for (const Luau::TypeError& error : module->errors)
+    {
+        if (Luau::get<Luau::CodeTooComplex>(error))
+            return std::string("instantiation limit");
+        if (Luau::get<Luau::UnificationTooComplex>(error))
+            return std::string("unifier iteration limit");
+    }
+
+    return std::nullopt;
+}
+
+// 모듈별 벽시계 예산. frontend.check마다 새 취소 토큰을 FrontendOptions로 넘기고, Luau가 모듈 검사를 시작할 때
+// 부르는 prepareModuleScope에서 마감을 다시 잡는다. 감시 스레드가 마감을 넘긴 검사의 토큰을 취소하면 Luau는
+// TypeCheckLimits::cancellationToken을 보고 그 검사를 멈춘다. 취소된 모듈은 결과가 기록되지 않아 다음 검사에서
+// 다시 시작되므로, 한 번 넘긴 모듈은 다시 시작하자마자 취소한다.
+class ModuleTimeBudget
+{
+public:
+    ModuleTimeBudget(Luau::Frontend& frontend, double limitSec)
+        : frontend(frontend)
+        , limit(std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(limitSec)))
+    {
+        frontend.prepareModuleScope = [this](const Luau::ModuleName& moduleName, const Luau::ScopePtr&, bool) {
+            enterModule(moduleName);
         };
+        watcher = std::thread([this] {
+            watch();
+        });
+    }
 
-        if (!requirePath.empty())
+    ~ModuleTimeBudget()
+    {
         {
-            if (auto resolved = tryResolve(currentDir / requirePath))
-                return resolved;
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        watcher.join();
+        frontend.prepareModuleScope = nullptr;
+    }
 
-            if (auto resolved = tryResolve(fs::path(requirePath)))
-                return resolved;
+    ModuleTimeBudget(const ModuleTimeBudget&) = delete;
+    ModuleTimeBudget& operator=(const ModuleTimeBudget&) = delete;
+
+    void check(const std::string& moduleName)
+    {
+        Luau::FrontendOptions checkOptions = frontend.options;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            token = std::make_shared<Luau::FrontendCancellationToken>();
+            checkOptions.cancellationToken = token;
         }
 
+        frontend.check(moduleName, checkOptions);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        finishModule(Clock::now());
+        if (token->requested() && exceededModules.find(moduleName) == exceededModules.end())
+            blockedBy[moduleName] = cancelledModule;
+        token.reset();
+    }
+
+    // 이번 실행에서 moduleName 검사가 예산을 넘겼으면 그 이유를 돌려준다.
+    std::optional<std::string> exceeded(const std::string& moduleName) const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (exceededModules.find(moduleName) != exceededModules.end())
+            return std::string("time limit");
+
+        auto it = blockedBy.find(moduleName);
+        if (it != blockedBy.end())
+            return "time limit while checking its dependency '" + it->second + "'";
+
         return std::nullopt;
     }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    // 정의 파일 로드처럼 check 밖에서 불리면 토큰이 없으므로 무시한다.
+    void enterModule(const std::string& moduleName)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!token)
+            return;
+
+        Clock::time_point now = Clock::now();
+        finishModule(now);
+        currentModule = moduleName;
+        if (exceededModules.find(moduleName) != exceededModules.end())
+        {
+            cancelledModule = moduleName;
+            token->cancel();
+            return;
+        }
+
+        startedAt = now;
+        deadline = now + limit;
+        wake.notify_all();
+    }
+
+    // 마감 전에 끝났어도 예산보다 오래 걸렸으면 넘긴 것으로 본다.
+    void finishModule(Clock::time_point now)
+    {
+        if (deadline && now - startedAt > limit)
+            exceededModules.insert(currentModule);
+        deadline.reset();
+    }
+
+    void watch()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (!stopping)
+        {
+            if (!deadline)
+            {
+                wake.wait(lock);
+                continue;
+            }
+
+            wake.wait_until(lock, *deadline);
+            if (deadline && Clock::now() >= *deadline)
+            {
+                exceededModules.insert(currentModule);
+                cancelledModule = currentModule;
+                deadline.reset();
+                token->cancel();
+            }
+        }
+    }
+
+    Luau::Frontend& frontend;
+    Clock::duration limit;
+
+    mutable std::mutex mutex;
+    std::condition_variable wake;
+    std::thread watcher;
+    bool stopping = false;
+
+    std::shared_ptr<Luau::FrontendCancellationToken> token;
+    std::string currentModule;
+    Clock::time_point startedAt;
+    std::optional<Clock::time_point> deadline;
+    std::string cancelledModule;
+
+    std::unordered_set<std::string> exceededModules;
+    // 의존 모듈이 취소되어 검사가 끝나지 못한 모듈 -> 그 의존 모듈
+    std::unordered_map<std::string, std::string> blockedBy;
 };
 
+static std::unique_ptr<ModuleTimeBudget> makeTimeBudget(Luau::Frontend& frontend, const GeneratorOptions& options)
+{
+    if (!options.moduleTimeLimitSec)
+        return nullptr;
+
+    return std::make_unique<ModuleTimeBudget>(frontend, *options.moduleTimeLimitSec);
+}
+
+static void checkModule(Luau::Frontend& frontend, ModuleTimeBudget* timeBudget, const std::string& moduleName)
+{
+    DOCGEN_TRACE_SCOPE("check", moduleName);
+    if (timeBudget)
+        timeBudget->check(moduleName);
+    else
+        frontend.check(moduleName);
+}
+
+// 예산을 넘긴 모듈은 부분적으로 추론된 타입을 쓰지 않고 Binding/문서 태그 기반 타입으로 돌아간다.
+// 취소된 검사는 모듈을 남기지 않으므로 module이 비어 있을 수 있다.
+static bool isWithinBudget(
+    const Luau::ModulePtr& module,
+    const ModuleContext& context,
+    const ModuleTimeBudget* timeBudget,
+    std::vector<Diagnostic>& diagnostics
+)
+{
+    std::optional<std::string> exceeded = timeBudget ? timeBudget->exceeded(context.moduleName) : std::nullopt;
+    if (!exceeded && module)
+        exceeded = findExceededBudget(module);
+    if (!exceeded)
+        return true;
+
+    diagnostics.push_back({
+        "warning",
+        context.rootRelativePath,
+        1,
+        "Type analysis of module '" + context.moduleName + "' exceeded the " + *exceeded
+            + "; falling back to syntactic types.",
+    });
+    return false;
+}
+
 static std::unordered_map<std::string, ModuleAnalysis> runFrontendAnalysis(
     Luau::Frontend& frontend,
-    const std::vector<ModuleContext>& contexts
+    const std::vector<ModuleContext>& contexts,
+    TypeDisplayCache* displayCache,
+    std::vector<Diagnostic>& diagnostics,
+    const std::vector<bool>* needsAnalysis,
+    MemoryReport* memoryReport,
+    ModuleTimeBudget* timeBudget
 )
 {
     std::unordered_map<std::string, ModuleAnalysis> analyses;
     analyses.reserve(contexts.size());
 
-    for (const ModuleContext& context : contexts)
+    for (size_t i = 0; i < contexts.size(); ++i)
     {
-        frontend.check(context.moduleName);
+        const ModuleContext& context = contexts[i];
+        if (needsAnalysis && !(*needsAnalysis)[i])
+            continue;
+
+        checkModule(frontend, timeBudget, context.moduleName);
 
         Luau::ModulePtr module = frontend.moduleResolver.getModule(context.moduleName);
+        if (!isWithinBudget(module, context, timeBudget, diagnostics))
+            continue;
+
         if (!module || !module->hasModuleScope())
             continue;
 
+        if (analyses.find(context.moduleName) != analyses.end())
+            continue;
+
+        if (memoryReport)
+            memoryReport->recordArena(context.moduleName, module);
+
         analyses.emplace(context.moduleName, ModuleAnalysis{
             context.moduleName,
             module,
             module->getModuleScope(),
+            displayCache,
         });
     }
 
@@ -1607,14 +2746,91 @@ static std::optional<Luau::TypeId> resolveSymbolType(const ModuleAnalysis* analy
     return resolveMemberType(*withinType, name);
 }
 
-static std::string toDisplayString(Luau::TypeId typeId, bool hideSelf)
+static std::string renderTypeDisplay(Luau::TypeId typeId, bool hideSelf)
+{
+    Luau::ToStringOptions options;
+    options.hideFunctionSelfArgument = hideSelf;
+    return Luau::toString(typeId, options);
+}
+
+// follow된 TypeId와 hideSelf 조합별로 렌더링 결과를 분석 수명 동안 재사용한다.
+struct TypeDisplayCache
+{
+    struct Key
+    {
+        const void* type = nullptr;
+        bool hideSelf = false;
+
+        bool operator==(const Key& other) const
+        {
+            return type == other.type && hideSelf == other.hideSelf;
+        }
+    };
+
+    struct KeyHash
+    {
+        size_t operator()(const Key& key) const
+        {
+            size_t hash = std::hash<const void*>()(key.type);
+            return key.hideSelf ? hash ^ 0x9e3779b9 : hash;
+        }
+    };
+
+    std::unordered_map<Key, std::string, KeyHash> entries;
+    // 모듈 하나를 해제할 때 그 모듈 아레나의 항목만 지우기 위한 색인. 전역 타입(아레나 없음)은 남는다.
+    std::unordered_map<const void*, std::vector<Key>> keysByArena;
+    size_t hits = 0;
+    size_t misses = 0;
+
+    const std::string& render(Luau::TypeId typeId, bool hideSelf)
+    {
+        Key key{static_cast<const void*>(typeId), hideSelf};
+        auto it = entries.find(key);
+        if (it != entries.end())
+        {
+            hits++;
+            return it->second;
+        }
+
+        misses++;
+        auto inserted = entries.emplace(key, renderTypeDisplay(typeId, hideSelf));
+        if (typeId->owningArena)
+            keysByArena[static_cast<const void*>(typeId->owningArena)].push_back(key);
+        return inserted.first->second;
+    }
+
+    // 타입 그래프를 해제하면 주소가 재사용될 수 있으므로 그 모듈 아레나의 항목을 해제 전에 지운다.
+    void evictModule(const Luau::Module& module)
+    {
+        for (const Luau::TypeArena* arena : {&module.internalTypes, &module.interfaceTypes})
+        {
+            auto it = keysByArena.find(static_cast<const void*>(arena));
+            if (it == keysByArena.end())
+                continue;
+
+            for (const Key& key : it->second)
+                entries.erase(key);
+            keysByArena.erase(it);
+        }
+    }
+
+    void clear()
+    {
+        entries.clear();
+        keysByArena.clear();
+    }
+};
+
+static std::string toDisplayString(TypeDisplayCache* cache, Luau::TypeId typeId, bool hideSelf)
 {
     if (!typeId)
         return "";
 
-    Luau::ToStringOptions options;
-    options.hideFunctionSelfArgument = hideSelf;
-    return Luau::toString(Luau::follow(typeId), options);
+    Luau::TypeId followed = Luau::follow(typeId);
+    if (!cache)
+        return renderTypeDisplay(followed, hideSelf);
+
+    return cache->render(followed, hideSelf);
 }
 
 struct FunctionAnalysis
@@ -1661,7 +2877,7 @@ static void collectFunctionTypes(
     }
 }
 
-static FunctionAnalysis analyzeFunctionType(Luau::TypeId typeId, bool isMethod)
+static FunctionAnalysis analyzeFunctionType(Luau::TypeId typeId, bool isMethod, TypeDisplayCache* displayCache)
 {
     FunctionAnalysis result;
 
@@ -1674,7 +2890,7 @@ static FunctionAnalysis analyzeFunctionType(Luau::TypeId typeId, bool isMethod)
 
     if (functionTypes.empty())
     {
-        result.display = toDisplayString(typeId, isMethod);
+        result.display = toDisplayString(displayCache, typeId, isMethod);
         return result;
     }
 
@@ -1704,7 +2920,7 @@ static FunctionAnalysis analyzeFunctionType(Luau::TypeId typeId, bool isMethod)
 
     for (size_t i = argOffset; i < argTypes.size(); ++i)
     {
-        std::string typeText = toDisplayString(argTypes[i], false);
+        std::string typeText = toDisplayString(displayCache, argTypes[i], false);
         result.paramTypes.push_back(typeText);
 
         size_t nameIndex = i;
@@ -1716,9 +2932,9 @@ static FunctionAnalysis analyzeFunctionType(Luau::TypeId typeId, bool isMethod)
     }
 
     for (Luau::TypeId retType : retTypes)
-        result.returnTypes.push_back(toDisplayString(retType, false));
+        result.returnTypes.push_back(toDisplayString(displayCache, retType, false));
 
-    result.display = toDisplayString(primaryType, isMethod);
+    result.display = toDisplayString(displayCache, primaryType, isMethod);
     return result;
 }
 
@@ -1851,7 +3067,7 @@ static Symbol buildSymbol(
     int locationLine = binding ? binding->line : block.startLine;
     symbol.file = relativePath;
     symbol.line = locationLine;
-    symbol.column = findColumn(source.lines, locationLine);
+    symbol.column = findColumn(source, locationLine);
 
     symbol.qualifiedName = buildQualifiedName(within, symbol.name, isMethod);
     symbol.visibility = doc.state.visibility.empty() ? "public" : doc.state.visibility;
@@ -1903,12 +3119,13 @@ static Symbol buildSymbol(
         symbol.tags.push_back({"inheritDoc", doc.state.inheritDoc, false, false, ""});
 
     std::optional<Luau::TypeId> officialType = resolveSymbolType(analysis, within, symbol.name);
+    TypeDisplayCache* displayCache = analysis ? analysis->displayCache : nullptr;
 
     if (symbol.kind == "function" || symbol.kind == "constructor")
     {
         FunctionAnalysis functionAnalysis;
         if (officialType)
-            functionAnalysis = analyzeFunctionType(*officialType, isMethod);
+            functionAnalysis = analyzeFunctionType(*officialType, isMethod, displayCache);
 
         symbol.types.yields = doc.state.yields;
 
@@ -1977,7 +3194,7 @@ static Symbol buildSymbol(
         std::string resolvedType = typeTag && !typeTag->type.empty() ? typeTag->type : "";
 
         if (resolvedType.empty() && officialType)
-            resolvedType = toDisplayString(*officialType, false);
+            resolvedType = toDisplayString(displayCache, *officialType, false);
 
         symbol.types.propertyType = resolvedType;
         symbol.types.readonly = doc.state.readonly;
@@ -1992,7 +3209,7 @@ static Symbol buildSymbol(
         if (typeTag && !typeTag->type.empty())
             symbol.types.typeAlias = typeTag->type;
         else if (officialType)
-            symbol.types.typeAlias = toDisplayString(*officialType, false);
+            symbol.types.typeAlias = toDisplayString(displayCache, *officialType, false);
 
         symbol.types.display = symbol.types.typeAlias;
     }
@@ -2004,24 +3221,39 @@ static Symbol buildSymbol(
     return symbol;
 }
 
+static std::vector<ParsedDoc> parseModuleDocs(const ModuleContext& context)
+{
+    std::vector<ParsedDoc> docs;
+    docs.reserve(context.blocks.size());
+    for (const DocBlock& block : context.blocks)
+        docs.push_back(parseDocBlock(docBlockLines(context.source, block)));
+    return docs;
+}
+
+// parsedDocs가 있으면 (지연 검사 계획에서 이미 파싱한) 블록을 다시 파싱하지 않는다.
 static std::vector<Symbol> buildSymbols(
     const ModuleContext& context,
     const ModuleAnalysis* analysis,
-    std::vector<Diagnostic>& diagnostics
+    std::vector<Diagnostic>& diagnostics,
+    const std::vector<ParsedDoc>* parsedDocs = nullptr
 )
 {
+    DOCGEN_TRACE_SCOPE("buildSymbols", context.moduleName);
+
     std::vector<Symbol> symbols;
-    std::vector<ParsedDoc> docs;
-    docs.reserve(context.blocks.size());
+    std::vector<ParsedDoc> ownDocs;
+    if (!parsedDocs)
+    {
+        ownDocs = parseModuleDocs(context);
+        parsedDocs = &ownDocs;
+    }
+    const std::vector<ParsedDoc>& docs = *parsedDocs;
 
     std::vector<std::string> classNames;
     std::string currentClassName;
 
-    for (const DocBlock& block : context.blocks)
+    for (const ParsedDoc& doc : docs)
     {
-        ParsedDoc doc = parseDocBlock(block.contentLines);
-        docs.push_back(doc);
-
         for (const TypeTag& tag : doc.typeTags)
         {
             if (tag.kind == "class" && !tag.name.empty())
@@ -2106,7 +3338,7 @@ static std::vector<Symbol> buildSymbols(
                 fieldSymbol.qualifiedName = symbol.name + "." + field.name;
                 fieldSymbol.file = context.rootRelativePath;
                 fieldSymbol.line = block.startLine;
-                fieldSymbol.column = findColumn(context.source.lines, block.startLine);
+                fieldSymbol.column = findColumn(context.source, block.startLine);
                 fieldSymbol.summary = field.description;
                 fieldSymbol.descriptionMarkdown = field.description;
                 fieldSymbol.visibility = symbol.visibility;
@@ -2129,7 +3361,7 @@ static std::vector<Symbol> buildSymbols(
                 fieldSymbol.qualifiedName = symbol.name + "." + field.name;
                 fieldSymbol.file = context.rootRelativePath;
                 fieldSymbol.line = field.line > 0 ? field.line : block.startLine;
-                fieldSymbol.column = field.column > 0 ? field.column : findColumn(context.source.lines, block.startLine);
+                fieldSymbol.column = field.column > 0 ? field.column : findColumn(context.source, block.startLine);
                 fieldSymbol.summary = field.description;
                 fieldSymbol.descriptionMarkdown = field.description;
                 fieldSymbol.visibility = symbol.visibility;
@@ -2192,821 +3424,5139 @@ static std::vector<Symbol> buildSymbols(
 }
 
 
-static void applyInheritDocs(std::vector<Symbol>& symbols)
+// 공식 타입이 있어야 채워지는 필드가 비어 있는 심볼만 타입 검사를 요구한다.
+static bool symbolNeedsAnalysis(const Symbol& symbol)
 {
-    std::unordered_map<std::string, size_t> byQualified;
-    for (size_t i = 0; i < symbols.size(); ++i)
-        byQualified[symbols[i].qualifiedName] = i;
+    if (symbol.kind == "function" || symbol.kind == "constructor")
+    {
+        if (symbol.types.returns.empty())
+            return true;
+
+        for (const ParamInfo& param : symbol.types.params)
+        {
+            if (param.type.empty())
+                return true;
+        }
+
+        for (const ReturnInfo& ret : symbol.types.returns)
+        {
+            if (ret.type.empty())
+                return true;
+        }
+
+        return false;
+    }
+
+    if (symbol.kind == "property")
+        return symbol.types.propertyType.empty();
+
+    if (symbol.kind == "type")
+        return symbol.types.typeAlias.empty();
+
+    return false;
+}
 
-    for (Symbol& symbol : symbols)
+struct LazyCheckPlan
+{
+    std::vector<bool> needsAnalysis;
+    // 검사하지 않는 모듈의 최종 심볼과 진단
+    std::vector<std::vector<Symbol>> symbols;
+    std::vector<std::vector<Diagnostic>> diagnostics;
+    // 검사할 모듈의 파싱된 문서 블록. 분석 뒤 심볼을 만들 때 다시 파싱하지 않는다. 전체 검사면 비어 있다.
+    std::vector<std::vector<ParsedDoc>> docs;
+
+    const std::vector<ParsedDoc>* parsedDocs(size_t index) const
     {
-        auto it = std::find_if(symbol.tags.begin(), symbol.tags.end(), [](const TagValue& tag) {
-            return tag.name == "inheritDoc" && !tag.value.empty();
-        });
+        return index < docs.size() ? &docs[index] : nullptr;
+    }
+};
 
-        if (it == symbol.tags.end())
-            continue;
+// 먼저 타입 분석 없이 심볼을 만들어 보고, 그 결과를 그대로 쓸 수 있는 모듈은 검사 대상에서 뺀다.
+static LazyCheckPlan planLazyCheck(const std::vector<ModuleContext>& contexts)
+{
+    LazyCheckPlan plan;
+    plan.needsAnalysis.assign(contexts.size(), false);
+    plan.symbols.resize(contexts.size());
+    plan.diagnostics.resize(contexts.size());
+    plan.docs.resize(contexts.size());
 
-        auto targetIt = byQualified.find(it->value);
-        if (targetIt == byQualified.end())
+    for (size_t i = 0; i < contexts.size(); ++i)
+    {
+        if (contexts[i].definition)
             continue;
 
-        const Symbol& target = symbols[targetIt->second];
+        plan.docs[i] = parseModuleDocs(contexts[i]);
+        plan.symbols[i] = buildSymbols(contexts[i], nullptr, plan.diagnostics[i], &plan.docs[i]);
+        plan.needsAnalysis[i] = std::any_of(plan.symbols[i].begin(), plan.symbols[i].end(), symbolNeedsAnalysis);
 
-        if (symbol.descriptionMarkdown.empty() && !target.descriptionMarkdown.empty())
+        // 검사할 모듈은 분석 뒤 심볼을 다시 만들므로 파싱 결과만 남기고, 그대로 쓸 모듈은 심볼만 남긴다.
+        if (plan.needsAnalysis[i])
         {
-            symbol.descriptionMarkdown = target.descriptionMarkdown;
-            symbol.summary = target.summary;
+            plan.symbols[i] = {};
+            plan.diagnostics[i] = {};
+        }
+        else
+        {
+            plan.docs[i] = {};
         }
-
-        bool onlyInheritTag = symbol.tags.size() == 1 && symbol.tags.front().name == "inheritDoc";
-        if ((symbol.tags.empty() || onlyInheritTag) && !target.tags.empty())
-            symbol.tags = target.tags;
-
-        if (symbol.types.display.empty() && !target.types.display.empty())
-            symbol.types = target.types;
     }
+
+    return plan;
 }
 
-static std::unordered_map<std::string, std::string> loadModuleOverrides(const fs::path& rootDir)
+static LazyCheckPlan planFullCheck(const std::vector<ModuleContext>& contexts)
 {
-    fs::path configPath = rootDir / "docs.config.json";
-    if (!fs::exists(configPath))
-        return {};
-
-    Source source = loadSource(configPath);
-    std::string content = source.content;
-    size_t pos = content.find("\"moduleIdOverrides\"");
-    if (pos == std::string::npos)
-        return {};
+    LazyCheckPlan plan;
+    plan.needsAnalysis.assign(contexts.size(), true);
+    plan.symbols.resize(contexts.size());
+    plan.diagnostics.resize(contexts.size());
+    return plan;
+}
 
-    size_t brace = content.find("{", pos);
-    if (brace == std::string::npos)
-        return {};
+// 정의 파일 하나를 전역 스코프에 올리고, 로드하면서 검사된 모듈로 문서 심볼을 만든다.
+// Luau는 정의 파일을 기본 TypeCheckLimits로 검사하므로 중간에 멈출 수 없다. 시간 예산은 로드가 끝난 뒤 확인해
+// 넘겼으면 그 파일의 문서만 구문 기반 타입으로 돌아간다. 선언은 이미 전역에 올라가 있다.
+static std::vector<Symbol> loadDefinitionModule(
+    Luau::Frontend& frontend,
+    const ModuleContext& context,
+    TypeDisplayCache* displayCache,
+    std::optional<double> timeLimitSec,
+    std::vector<Diagnostic>& diagnostics
+)
+{
+    DOCGEN_TRACE_SCOPE("loadDefinitionFile", context.moduleName);
+
+    auto start = std::chrono::steady_clock::now();
+    Luau::LoadDefinitionFileResult result = frontend.loadDefinitionFile(
+        frontend.globals,
+        frontend.globals.globalScope,
+        context.source.content,
+        "@definitions/" + context.moduleName,
+        false
+    );
+    double elapsedSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
 
-    size_t depth = 0;
-    size_t end = brace;
-    for (; end < content.size(); ++end)
+    std::optional<ModuleAnalysis> analysis;
+    if (!result.success)
     {
-        if (content[end] == '{')
-            depth++;
-        else if (content[end] == '}')
+        int line = result.parseResult.errors.empty() ? 1 : int(result.parseResult.errors.front().getLocation().begin.line) + 1;
+        diagnostics.push_back({
+            "warning",
+            context.rootRelativePath,
+            line,
+            "Failed to load definition file; its declarations are not visible to other modules.",
+        });
+    }
+    else if (result.module && result.module->hasModuleScope())
+    {
+        std::optional<std::string> exceeded = findExceededBudget(result.module);
+        if (!exceeded && timeLimitSec && elapsedSec > *timeLimitSec)
+            exceeded = "time limit";
+
+        if (exceeded)
         {
-            depth--;
-            if (depth == 0)
-                break;
+            diagnostics.push_back({
+                "warning",
+                context.rootRelativePath,
+                1,
+                "Loading definition file '" + context.moduleName + "' exceeded the " + *exceeded
+                    + "; its declarations are loaded, but its documentation falls back to syntactic types.",
+            });
+        }
+        else
+        {
+            analysis = ModuleAnalysis{
+                context.moduleName,
+                result.module,
+                result.module->getModuleScope(),
+                displayCache,
+            };
         }
     }
 
-    if (end >= content.size())
-        return {};
+    return buildSymbols(context, analysis ? &*analysis : nullptr, diagnostics);
+}
 
-    std::string objectText = content.substr(brace + 1, end - brace - 1);
-    std::unordered_map<std::string, std::string> overrides;
-    size_t cursor = 0;
-    while (cursor < objectText.size())
-    {
-        size_t keyStart = objectText.find('"', cursor);
-        if (keyStart == std::string::npos)
-            break;
-        size_t keyEnd = objectText.find('"', keyStart + 1);
-        if (keyEnd == std::string::npos)
-            break;
-        std::string key = objectText.substr(keyStart + 1, keyEnd - keyStart - 1);
+// 내장 전역과 typesDir 정의 파일을 한 번만 올리고 얼린다. 이후 모든 모듈 검사가 이 전역 환경을 같이 쓰고,
+// 정의 파일은 검사 대상에서 빠진다.
+static void loadDefinitionGlobals(
+    Luau::Frontend& frontend,
+    const std::vector<ModuleContext>& contexts,
+    TypeDisplayCache* displayCache,
+    std::optional<double> timeLimitSec,
+    LazyCheckPlan& plan
+)
+{
+    DOCGEN_TRACE_SCOPE("loadDefinitionGlobals", "");
+    Luau::registerBuiltinGlobals(frontend, frontend.globals);
 
-        size_t valueStart = objectText.find('"', keyEnd + 1);
-        if (valueStart == std::string::npos)
-            break;
-        size_t valueEnd = objectText.find('"', valueStart + 1);
-        if (valueEnd == std::string::npos)
-            break;
-        std::string value = objectText.substr(valueStart + 1, valueEnd - valueStart - 1);
+    for (size_t i = 0; i < contexts.size(); ++i)
+    {
+        if (!contexts[i].definition)
+            continue;
 
-        std::replace(key.begin(), key.end(), '\\', '/');
-        overrides[key] = value;
-        cursor = valueEnd + 1;
+        plan.needsAnalysis[i] = false;
+        plan.symbols[i] = loadDefinitionModule(frontend, contexts[i], displayCache, timeLimitSec, plan.diagnostics[i]);
     }
 
-    return overrides;
+    Luau::freeze(frontend.globals.globalTypes);
 }
 
-static std::vector<fs::path> collectFiles(const fs::path& rootDir)
+struct DependencyNode
 {
-    std::vector<fs::path> files;
-    if (!fs::exists(rootDir))
-        return files;
+    std::string moduleName;
+    std::vector<size_t> contexts;
+    std::vector<size_t> dependencies;
+};
 
-    for (auto& entry : fs::directory_iterator(rootDir))
+struct DependencyGraph
+{
+    std::vector<DependencyNode> nodes;
+    std::vector<size_t> order;
+};
+
+// 같은 이름의 컨텍스트는 하나의 노드로 묶고, 의존 모듈이 먼저 오도록 후위 순서로 정렬한다.
+static DependencyGraph buildDependencyGraph(Luau::Frontend& frontend, const std::vector<ModuleContext>& contexts)
+{
+    DependencyGraph graph;
+    std::unordered_map<std::string, size_t> nodeByName;
+
+    for (size_t i = 0; i < contexts.size(); ++i)
     {
-        fs::path entryPath = entry.path();
-        std::string name = entryPath.filename().string();
-        if (!name.empty() && name[0] == '.')
+        if (contexts[i].definition)
             continue;
 
-        if (entry.is_directory())
+        auto inserted = nodeByName.emplace(contexts[i].moduleName, graph.nodes.size());
+        if (inserted.second)
         {
-            if (name == "node_modules")
+            DependencyNode node;
+            node.moduleName = contexts[i].moduleName;
+            graph.nodes.push_back(std::move(node));
+        }
+        graph.nodes[inserted.first->second].contexts.push_back(i);
+    }
+
+    for (size_t i = 0; i < graph.nodes.size(); ++i)
+    {
+        DependencyNode& node = graph.nodes[i];
+        frontend.parse(node.moduleName);
+
+        auto sourceIt = frontend.sourceNodes.find(node.moduleName);
+        if (sourceIt == frontend.sourceNodes.end() || !sourceIt->second)
+            continue;
+
+        for (const auto& required : sourceIt->second->requireLocations)
+        {
+            auto depIt = nodeByName.find(required.first);
+            if (depIt == nodeByName.end() || depIt->second == i)
                 continue;
-            std::vector<fs::path> nested = collectFiles(entryPath);
-            files.insert(files.end(), nested.begin(), nested.end());
+
+            if (std::find(node.dependencies.begin(), node.dependencies.end(), depIt->second) != node.dependencies.end())
+                continue;
+
+            node.dependencies.push_back(depIt->second);
+        }
+    }
+
+    std::vector<bool> visited(graph.nodes.size(), false);
+    graph.order.reserve(graph.nodes.size());
+
+    for (size_t root = 0; root < graph.nodes.size(); ++root)
+    {
+        if (visited[root])
             continue;
+
+        std::vector<std::pair<size_t, size_t>> stack;
+        stack.emplace_back(root, 0);
+        visited[root] = true;
+
+        while (!stack.empty())
+        {
+            size_t current = stack.back().first;
+            size_t next = stack.back().second;
+            const std::vector<size_t>& dependencies = graph.nodes[current].dependencies;
+
+            if (next < dependencies.size())
+            {
+                stack.back().second++;
+                size_t dependency = dependencies[next];
+                if (!visited[dependency])
+                {
+                    visited[dependency] = true;
+                    stack.emplace_back(dependency, 0);
+                }
+                continue;
+            }
+
+            graph.order.push_back(current);
+            stack.pop_back();
         }
+    }
 
-        std::string ext = entryPath.extension().string();
-        if (ext == ".luau" || ext == ".lua")
-            files.push_back(entryPath);
+    return graph;
+}
+
+// 모듈마다 그 모듈을 (직간접적으로) require하는 마지막 노드의 검사 순서 위치를 구한다.
+// 다시 내보낸 타입은 dependent의 dependent까지 원래 모듈의 아레나를 가리키므로 직접 dependent만으로는 부족하다.
+static std::vector<size_t> computeLastUse(const DependencyGraph& graph)
+{
+    std::vector<size_t> lastUse(graph.nodes.size(), 0);
+    for (size_t position = 0; position < graph.order.size(); ++position)
+        lastUse[graph.order[position]] = position;
+
+    // 순환이 있으면 한 번에 끝나지 않으므로 더 바뀌지 않을 때까지 dependent의 값을 의존 모듈로 올린다.
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (size_t position = graph.order.size(); position-- > 0;)
+        {
+            size_t index = graph.order[position];
+            for (size_t dependency : graph.nodes[index].dependencies)
+            {
+                if (lastUse[dependency] < lastUse[index])
+                {
+                    lastUse[dependency] = lastUse[index];
+                    changed = true;
+                }
+            }
+        }
     }
 
-    return files;
+    return lastUse;
 }
 
-static std::string sha1(const std::string& input)
+// 모듈을 하나씩 검사하면서 곧바로 심볼을 추출하고,
+// 직간접 dependent까지 모두 추출이 끝난 모듈의 타입 그래프는 즉시 해제한다.
+static std::vector<std::vector<Symbol>> runBoundedAnalysis(
+    Luau::Frontend& frontend,
+    const std::vector<ModuleContext>& contexts,
+    TypeDisplayCache* displayCache,
+    std::vector<std::vector<Diagnostic>>& contextDiagnostics,
+    const LazyCheckPlan& plan,
+    MemoryReport* memoryReport,
+    ModuleTimeBudget* timeBudget,
+    size_t& peakLiveModules
+)
 {
-    uint32_t h0 = 0x67452301;
-    uint32_t h1 = 0xEFCDAB89;
-    uint32_t h2 = 0x98BADCFE;
-    uint32_t h3 = 0x10325476;
-    uint32_t h4 = 0xC3D2E1F0;
+    std::vector<std::vector<Symbol>> symbols(contexts.size());
+    contextDiagnostics.assign(contexts.size(), {});
+    peakLiveModules = 0;
+
+    DependencyGraph graph = buildDependencyGraph(frontend, contexts);
+    std::vector<size_t> lastUse = computeLastUse(graph);
+    std::vector<std::vector<size_t>> releaseAfter(graph.order.size());
+    for (size_t i = 0; i < graph.nodes.size(); ++i)
+        releaseAfter[lastUse[i]].push_back(i);
+
+    // 실제로 검사된 모듈만 센다. lazy 검사에서는 필요한 모듈을 검사하면서 그 의존 모듈도 같이 검사된다.
+    std::vector<bool> live(graph.nodes.size(), false);
+    std::vector<bool> released(graph.nodes.size(), false);
+    size_t liveModules = 0;
+
+    auto countChecked = [&](size_t root) {
+        std::vector<size_t> stack{root};
+        while (!stack.empty())
+        {
+            size_t index = stack.back();
+            stack.pop_back();
+            if (live[index] || released[index] || !frontend.moduleResolver.getModule(graph.nodes[index].moduleName))
+                continue;
 
-    std::vector<uint8_t> data(input.begin(), input.end());
-    uint64_t bitLen = static_cast<uint64_t>(data.size()) * 8;
+            live[index] = true;
+            liveModules++;
+            for (size_t dependency : graph.nodes[index].dependencies)
+                stack.push_back(dependency);
+        }
+        peakLiveModules = std::max(peakLiveModules, liveModules);
+    };
 
-    data.push_back(0x80);
-    while ((data.size() * 8) % 512 != 448)
-        data.push_back(0x00);
+    auto release = [&](size_t index) {
+        released[index] = true;
+        const std::string& moduleName = graph.nodes[index].moduleName;
+        Luau::ModulePtr module = frontend.moduleResolver.getModule(moduleName);
+        if (!module)
+            return;
 
-    for (int i = 7; i >= 0; --i)
-        data.push_back(static_cast<uint8_t>((bitLen >> (i * 8)) & 0xff));
+        if (displayCache)
+            displayCache->evictModule(*module);
+        frontend.moduleResolver.setModule(moduleName, nullptr);
+        if (live[index])
+        {
+            live[index] = false;
+            liveModules--;
+        }
+    };
 
-    for (size_t chunk = 0; chunk < data.size(); chunk += 64)
+    for (size_t position = 0; position < graph.order.size(); ++position)
     {
-        uint32_t w[80] = {0};
-        for (int i = 0; i < 16; ++i)
+        size_t index = graph.order[position];
+        const DependencyNode& node = graph.nodes[index];
+
+        bool needed = false;
+        for (size_t contextIndex : node.contexts)
         {
-            w[i] = (data[chunk + i * 4 + 0] << 24) |
-                   (data[chunk + i * 4 + 1] << 16) |
-                   (data[chunk + i * 4 + 2] << 8) |
-                   (data[chunk + i * 4 + 3]);
+            if (plan.needsAnalysis[contextIndex])
+                needed = true;
         }
-        for (int i = 16; i < 80; ++i)
+
+        if (needed)
         {
-            uint32_t value = w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16];
-            w[i] = (value << 1) | (value >> 31);
-        }
+            checkModule(frontend, timeBudget, node.moduleName);
 
-        uint32_t a = h0;
-        uint32_t b = h1;
-        uint32_t c = h2;
-        uint32_t d = h3;
-        uint32_t e = h4;
+            Luau::ModulePtr module = frontend.moduleResolver.getModule(node.moduleName);
+            if (module && memoryReport)
+                memoryReport->recordArena(node.moduleName, module);
+            countChecked(index);
 
-        for (int i = 0; i < 80; ++i)
-        {
-            uint32_t f;
-            uint32_t k;
-            if (i < 20)
-            {
-                f = (b & c) | ((~b) & d);
-                k = 0x5A827999;
-            }
-            else if (i < 40)
-            {
-                f = b ^ c ^ d;
-                k = 0x6ED9EBA1;
-            }
-            else if (i < 60)
+            // 같은 모듈 이름의 컨텍스트마다 따로 경고를 남긴다.
+            bool withinBudget = true;
+            for (size_t contextIndex : node.contexts)
+                withinBudget = isWithinBudget(module, contexts[contextIndex], timeBudget, contextDiagnostics[contextIndex]) && withinBudget;
+            withinBudget = withinBudget && module && module->hasModuleScope();
+
+            std::optional<ModuleAnalysis> analysis;
+            if (withinBudget)
             {
-                f = (b & c) | (b & d) | (c & d);
-                k = 0x8F1BBCDC;
+                analysis = ModuleAnalysis{
+                    node.moduleName,
+                    module,
+                    module->getModuleScope(),
+                    displayCache,
+                };
             }
-            else
+
+            for (size_t contextIndex : node.contexts)
             {
-                f = b ^ c ^ d;
-                k = 0xCA62C1D6;
+                symbols[contextIndex] = buildSymbols(
+                    contexts[contextIndex],
+                    analysis ? &*analysis : nullptr,
+                    contextDiagnostics[contextIndex],
+                    plan.parsedDocs(contextIndex)
+                );
             }
-
-            uint32_t temp = ((a << 5) | (a >> 27)) + f + e + k + w[i];
-            e = d;
-            d = c;
-            c = (b << 30) | (b >> 2);
-            b = a;
-            a = temp;
         }
 
-        h0 += a;
-        h1 += b;
-        h2 += c;
-        h3 += d;
-        h4 += e;
+        for (size_t done : releaseAfter[position])
+            release(done);
     }
 
-    std::ostringstream out;
-    out << std::hex << std::nouppercase;
-    out << std::setw(8) << std::setfill('0') << h0;
-    out << std::setw(8) << std::setfill('0') << h1;
-    out << std::setw(8) << std::setfill('0') << h2;
-    out << std::setw(8) << std::setfill('0') << h3;
-    out << std::setw(8) << std::setfill('0') << h4;
-    return out.str();
+    return symbols;
 }
 
-class JsonWriter
+struct SymbolRef
 {
-public:
-    explicit JsonWriter(std::ostream& out)
-        : out(out)
-    {
-    }
+    size_t module = 0;
+    size_t symbol = 0;
+};
 
-    void beginObject()
-    {
-        writeCommaIfNeeded();
-        out << "{";
-        pushContext(true);
-    }
+struct ClassExtends
+{
+    std::string name;
+    std::optional<size_t> classIndex;
+};
 
-    void endObject()
+struct ClassEntry
+{
+    std::string name;
+    SymbolRef classSymbol;
+    std::vector<ClassExtends> extends;
+    std::vector<SymbolRef> members;
+};
+
+// 모든 모듈의 심볼을 한 번에 색인한다.
+// @inheritDoc, @extends, 클래스 멤버 관계를 모듈 경계와 무관하게 해석한다.
+struct SymbolIndex
+{
+    std::unordered_map<std::string, std::vector<SymbolRef>> byQualifiedName;
+    std::unordered_map<std::string, size_t> classesByName;
+    std::vector<ClassEntry> classes;
+
+    std::optional<SymbolRef> findQualified(const std::string& qualifiedName, size_t preferredModule) const
     {
-        if (contextStack.empty())
-            return;
-        Context ctx = contextStack.back();
-        popContext();
-        if (ctx.first)
+        auto it = byQualifiedName.find(qualifiedName);
+        if (it == byQualifiedName.end() || it->second.empty())
+            return std::nullopt;
+
+        for (auto ref = it->second.rbegin(); ref != it->second.rend(); ++ref)
         {
-            out << "}";
-            return;
+            if (ref->module == preferredModule)
+                return *ref;
         }
-        out << "\n";
-        writeIndent();
-        out << "}";
+
+        return it->second.front();
     }
 
-    void beginArray()
+    std::optional<size_t> findClass(const std::string& name) const
     {
-        writeCommaIfNeeded();
-        out << "[";
-        pushContext(false);
+        auto it = classesByName.find(name);
+        if (it == classesByName.end())
+            return std::nullopt;
+        return it->second;
     }
+};
 
-    void endArray()
+static std::string extractWithinName(const std::string& qualifiedName)
+{
+    size_t colon = qualifiedName.find(':');
+    if (colon != std::string::npos)
+        return qualifiedName.substr(0, colon);
+
+    size_t dot = qualifiedName.rfind('.');
+    if (dot != std::string::npos)
+        return qualifiedName.substr(0, dot);
+
+    return "";
+}
+
+static SymbolIndex buildSymbolIndex(const std::vector<Module>& modules)
+{
+    SymbolIndex index;
+
+    for (size_t moduleIndex = 0; moduleIndex < modules.size(); ++moduleIndex)
     {
-        if (contextStack.empty())
-            return;
-        Context ctx = contextStack.back();
-        popContext();
-        if (ctx.first)
+        const std::vector<Symbol>& symbols = modules[moduleIndex].symbols;
+        for (size_t symbolIndex = 0; symbolIndex < symbols.size(); ++symbolIndex)
         {
-            out << "]";
-            return;
+            const Symbol& symbol = symbols[symbolIndex];
+            SymbolRef ref{moduleIndex, symbolIndex};
+            index.byQualifiedName[symbol.qualifiedName].push_back(ref);
+
+            if (symbol.kind != "class" || symbol.name.empty())
+                continue;
+
+            if (index.classesByName.find(symbol.name) != index.classesByName.end())
+                continue;
+
+            index.classesByName.emplace(symbol.name, index.classes.size());
+            index.classes.push_back({symbol.name, ref, {}, {}});
         }
-        out << "\n";
-        writeIndent();
-        out << "]";
     }
 
-    void key(const std::string& name)
+    for (size_t moduleIndex = 0; moduleIndex < modules.size(); ++moduleIndex)
     {
-        if (!contextStack.empty())
+        const std::vector<Symbol>& symbols = modules[moduleIndex].symbols;
+        for (size_t symbolIndex = 0; symbolIndex < symbols.size(); ++symbolIndex)
         {
-            Context& ctx = contextStack.back();
-            if (!ctx.first)
-                out << ",";
-            ctx.first = false;
+            const Symbol& symbol = symbols[symbolIndex];
+            if (symbol.kind == "class")
+                continue;
+
+            std::string within = extractWithinName(symbol.qualifiedName);
+            if (within.empty())
+                continue;
+
+            if (std::optional<size_t> classIndex = index.findClass(within))
+                index.classes[*classIndex].members.push_back({moduleIndex, symbolIndex});
         }
-        out << "\n";
-        writeIndent();
-        writeString(name);
-        out << ": ";
     }
 
-    void valueString(const std::string& value)
+    for (ClassEntry& entry : index.classes)
     {
-        writeCommaIfNeeded();
-        writeString(value);
+        const Symbol& classSymbol = modules[entry.classSymbol.module].symbols[entry.classSymbol.symbol];
+        for (const TagValue& tag : classSymbol.tags)
+        {
+            if (tag.name == "extends" && !tag.value.empty())
+                entry.extends.push_back({tag.value, index.findClass(tag.value)});
+        }
     }
 
-    void valueNumber(int value)
-    {
-        writeCommaIfNeeded();
-        out << value;
-    }
+    return index;
+}
 
-    void valueBool(bool value)
+static void inheritDocFrom(Symbol& symbol, const Symbol& target)
+{
+    if (symbol.descriptionMarkdown.empty() && !target.descriptionMarkdown.empty())
     {
-        writeCommaIfNeeded();
-        out << (value ? "true" : "false");
+        symbol.descriptionMarkdown = target.descriptionMarkdown;
+        symbol.summary = target.summary;
     }
 
-    void valueNull()
+    bool onlyInheritTag = symbol.tags.size() == 1 && symbol.tags.front().name == "inheritDoc";
+    if ((symbol.tags.empty() || onlyInheritTag) && !target.tags.empty())
+        symbol.tags = target.tags;
+
+    if (symbol.types.display.empty() && !target.types.display.empty())
+        symbol.types = target.types;
+}
+
+static const std::string* findInheritDocTarget(const Symbol& symbol)
+{
+    auto it = std::find_if(symbol.tags.begin(), symbol.tags.end(), [](const TagValue& tag) {
+        return tag.name == "inheritDoc" && !tag.value.empty();
+    });
+    return it == symbol.tags.end() ? nullptr : &it->value;
+}
+
+static void applyInheritDocs(std::vector<Module>& modules, const SymbolIndex& index)
+{
+    for (size_t moduleIndex = 0; moduleIndex < modules.size(); ++moduleIndex)
     {
-        writeCommaIfNeeded();
-        out << "null";
+        for (Symbol& symbol : modules[moduleIndex].symbols)
+        {
+            const std::string* targetName = findInheritDocTarget(symbol);
+            if (!targetName)
+                continue;
+
+            std::optional<SymbolRef> targetRef = index.findQualified(*targetName, moduleIndex);
+            if (!targetRef)
+                continue;
+
+            const Symbol& target = modules[targetRef->module].symbols[targetRef->symbol];
+            if (&target == &symbol)
+                continue;
+
+            inheritDocFrom(symbol, target);
+        }
     }
+}
 
-private:
-    struct Context
-    {
-        bool isObject;
-        bool first = true;
+// --class-layout: docusaurus-plugin-reference(generate.js)가 클래스 페이지마다 하던 그룹핑/정렬/앵커 계산을 미리 해 둔다.
+// 아래 함수들은 generate.js의 같은 이름 함수와 결과가 같아야 한다.
+static const char* const kSectionOrder[] = {"type", "interface", "constructor", "property", "method", "function", "event"};
+
+static const char* sectionLabel(const std::string& kind)
+{
+    static const std::unordered_map<std::string, const char*> labels = {
+        {"type", "Types"},
+        {"interface", "Interfaces"},
+        {"constructor", "Constructors"},
+        {"property", "Properties"},
+        {"method", "Methods"},
+        {"function", "Functions"},
+        {"event", "Events"},
     };
 
-    std::ostream& out;
-    std::vector<Context> contextStack;
+    auto it = labels.find(kind);
+    return it == labels.end() ? nullptr : it->second;
+}
 
-    void pushContext(bool isObject)
-    {
-        contextStack.push_back({isObject, true});
-    }
+// String.prototype.localeCompare(기본 로캘, ICU root 콜레이션)를 ASCII 범위에서 재현한다.
+// 1차 비교는 대소문자를 무시하고 공백 < 구두점 < 숫자 < 문자 순이며, 같으면 소문자가 앞선다.
+static int collationPrimaryWeight(unsigned char c)
+{
+    static const std::array<int, 256> weights = [] {
+        std::array<int, 256> table{};
+        const char* order = "\t\n\v\f\r _-,;:!?.'\"()[]{}@*/\\&#%`^+<=>|~$0123456789abcdefghijklmnopqrstuvwxyz";
+        int weight = 1;
+        for (const char* it = order; *it; ++it)
+            table[static_cast<unsigned char>(*it)] = weight++;
+        for (int upper = 'A'; upper <= 'Z'; ++upper)
+            table[upper] = table[upper - 'A' + 'a'];
+        for (int high = 0x80; high < 0x100; ++high)
+            table[high] = weight + high;
+        return table;
+    }();
+    return weights[c];
+}
 
-    void popContext()
+static int localeCompare(std::string_view left, std::string_view right)
+{
+    size_t i = 0;
+    size_t j = 0;
+    int tertiary = 0;
+    while (true)
     {
-        if (!contextStack.empty())
-            contextStack.pop_back();
+        // 가중치 0인 제어 문자는 무시한다.
+        while (i < left.size() && collationPrimaryWeight(static_cast<unsigned char>(left[i])) == 0)
+            i++;
+        while (j < right.size() && collationPrimaryWeight(static_cast<unsigned char>(right[j])) == 0)
+            j++;
+
+        if (i == left.size() || j == right.size())
+            break;
+
+        unsigned char a = static_cast<unsigned char>(left[i]);
+        unsigned char b = static_cast<unsigned char>(right[j]);
+        int primary = collationPrimaryWeight(a) - collationPrimaryWeight(b);
+        if (primary != 0)
+            return primary < 0 ? -1 : 1;
+
+        if (tertiary == 0 && a != b)
+            tertiary = std::islower(a) ? -1 : 1;
+
+        i++;
+        j++;
     }
 
-    void writeIndent(int extra = 0)
+    bool leftDone = i == left.size();
+    bool rightDone = j == right.size();
+    if (leftDone != rightDone)
+        return leftDone ? -1 : 1;
+
+    return tertiary;
+}
+
+static bool hasEventTag(const Symbol& symbol)
+{
+    for (const TagValue& tag : symbol.tags)
     {
-        size_t total = contextStack.size() + extra;
-        for (size_t i = 0; i < total; ++i)
-            out << "  ";
+        if (tag.name == "event")
+            return true;
+
+        if (tag.name == "tag" && !tag.hasBool)
+        {
+            std::string value = tag.value;
+            std::transform(value.begin(), value.end(), value.begin(), [](unsigned char c) {
+                return static_cast<char>(std::tolower(c));
+            });
+            if (value == "event")
+                return true;
+        }
     }
+    return false;
+}
 
-    void writeCommaIfNeeded()
+static std::string layoutGroupKind(const Symbol& symbol)
+{
+    std::string kind = symbol.kind.empty() ? "module" : symbol.kind;
+    if (kind == "constructor")
+        return kind;
+
+    if (kind == "function")
     {
-        if (contextStack.empty())
-            return;
-        Context& ctx = contextStack.back();
-        if (ctx.isObject)
-            return;
-        if (!ctx.first)
-            out << ",";
-        out << "\n";
-        writeIndent();
-        ctx.first = false;
+        char separator = 0;
+        if (symbol.qualifiedName.find(':') != std::string::npos)
+            separator = ':';
+        else if (symbol.qualifiedName.find('.') != std::string::npos)
+            separator = '.';
+
+        if (separator == ':' && !symbol.name.empty())
+            return "method";
+        if (symbol.name == "new" && separator == '.' && !extractWithinName(symbol.qualifiedName).empty())
+            return "constructor";
     }
 
-    void writeString(const std::string& value)
+    if (hasEventTag(symbol) && kind != "class" && kind != "module")
+        return "event";
+    if (kind == "field")
+        return "interface";
+    return kind;
+}
+
+static std::optional<std::string> sanitizeAnchorId(const std::string& value)
+{
+    std::string trimmed = trim(value);
+    std::string cleaned;
+    cleaned.reserve(trimmed.size());
+
+    bool inSpace = false;
+    for (char c : trimmed)
     {
-        out << "\"";
-        for (char ch : value)
+        unsigned char uc = static_cast<unsigned char>(c);
+        if (std::isspace(uc))
         {
-            switch (ch)
-            {
-            case '\\':
-                out << "\\\\";
-                break;
-            case '"':
-                out << "\\\"";
-                break;
-            case '\n':
-                out << "\\n";
-                break;
-            case '\r':
-                out << "\\r";
-                break;
-            case '\t':
-                out << "\\t";
-                break;
-            default:
-                out << ch;
-                break;
-            }
+            if (!inSpace)
+                cleaned.push_back('-');
+            inSpace = true;
+            continue;
         }
-        out << "\"";
+
+        inSpace = false;
+        if (std::isalnum(uc) || c == '_' || c == '-')
+            cleaned.push_back(c);
     }
-};
 
-static void writeTagArray(JsonWriter& writer, const std::vector<TagValue>& tags)
+    if (cleaned.empty())
+        return std::nullopt;
+    return cleaned;
+}
+
+static std::optional<std::string> createAnchorId(
+    const std::string& name,
+    const std::string& qualifiedName,
+    const std::string& headingLabel,
+    std::unordered_set<std::string>& usedIds
+)
 {
-    writer.beginArray();
-    for (const TagValue& tag : tags)
+    std::vector<std::string> candidates;
+    auto addCandidate = [&](const std::optional<std::string>& candidate) {
+        if (candidate && std::find(candidates.begin(), candidates.end(), *candidate) == candidates.end())
+            candidates.push_back(*candidate);
+    };
+
+    addCandidate(sanitizeAnchorId(name));
+    addCandidate(sanitizeAnchorId(qualifiedName));
+    addCandidate(sanitizeAnchorId(headingLabel));
+
+    if (candidates.empty())
+        return std::nullopt;
+
+    for (const std::string& candidate : candidates)
     {
-        writer.beginObject();
-        writer.key("name");
-        writer.valueString(tag.name);
-        writer.key("value");
-        if (tag.hasBool)
-            writer.valueBool(tag.boolValue);
-        else
-            writer.valueString(tag.value);
-        if (!tag.description.empty())
-        {
-            writer.key("description");
-            writer.valueString(tag.description);
-        }
-        writer.endObject();
+        if (usedIds.insert(candidate).second)
+            return candidate;
+    }
+
+    for (int suffix = 2;; ++suffix)
+    {
+        std::string next = candidates.front() + "-" + std::to_string(suffix);
+        if (usedIds.insert(next).second)
+            return next;
     }
-    writer.endArray();
 }
 
-static void writeParams(JsonWriter& writer, const std::vector<ParamInfo>& params)
+static std::string sanitizeModulePath(const std::string& moduleId)
 {
-    writer.beginArray();
-    for (const ParamInfo& param : params)
+    std::string normalized = moduleId;
+    std::replace(normalized.begin(), normalized.end(), '\\', '/');
+
+    std::string result;
+    size_t start = 0;
+    while (true)
     {
-        writer.beginObject();
-        writer.key("name");
-        writer.valueString(param.name);
-        writer.key("type");
-        if (param.type.empty())
-            writer.valueNull();
-        else
-            writer.valueString(param.type);
-        writer.key("description");
-        std::string desc;
-        if (!param.description.empty())
+        size_t slash = normalized.find('/', start);
+        std::string segment = trim(normalized.substr(start, slash == std::string::npos ? std::string::npos : slash - start));
+        if (segment.empty())
+            segment = "unnamed";
+
+        for (char& c : segment)
         {
-            for (size_t i = 0; i < param.description.size(); ++i)
-            {
-                if (i > 0)
-                    desc += "\n";
-                desc += trim(param.description[i]);
-            }
-            desc = trim(desc);
+            if (std::strchr("<>:\"|?*", c) != nullptr)
+                c = '_';
         }
-        if (desc.empty())
-            writer.valueNull();
-        else
-            writer.valueString(desc);
-        writer.endObject();
+
+        result += segment;
+        if (slash == std::string::npos)
+            break;
+
+        result += '/';
+        start = slash + 1;
     }
-    writer.endArray();
+    return result;
 }
 
-static void writeReturns(JsonWriter& writer, const std::vector<ReturnInfo>& returns)
+struct LayoutMember
 {
-    writer.beginArray();
-    for (const ReturnInfo& ret : returns)
-    {
-        writer.beginObject();
+    SymbolRef ref;
+    std::optional<std::string> anchor;
+};
+
+struct LayoutSection
+{
+    std::string kind;
+    std::string label;
+    std::string anchor;
+    std::vector<LayoutMember> members;
+};
+
+struct ClassLayout
+{
+    std::string path;
+    std::string link;
+    std::vector<std::string> categories;
+    std::vector<LayoutSection> sections;
+};
+
+struct ClassLayoutSet
+{
+    std::vector<ClassLayout> classes;
+    std::vector<size_t> order;
+    // 정렬 키가 모두 ASCII면 true. localeCompare는 ASCII 범위만 재현하므로 false면 출력에 레이아웃을 쓰지 않고
+    // generate.js가 직접 정렬하게 둔다.
+    bool asciiCollation = true;
+};
+
+static bool isAsciiText(std::string_view text)
+{
+    return std::all_of(text.begin(), text.end(), [](char ch) {
+        return static_cast<unsigned char>(ch) < 0x80;
+    });
+}
+
+// 클래스 레이아웃에 필요한 심볼 정보. 스트리밍 출력은 모듈을 쓰고 버리므로 클래스와 멤버 후보의 이것만 남긴다.
+// @inheritDoc이 태그를 채울 수 있으므로 상속을 적용한 뒤 만든다.
+struct LayoutSymbol
+{
+    std::string group;
+    std::string name;
+    std::string qualifiedName;
+    // 클래스 심볼의 @category 값
+    std::vector<std::string> categories;
+};
+
+static LayoutSymbol makeLayoutSymbol(const Symbol& symbol)
+{
+    LayoutSymbol layoutSymbol{layoutGroupKind(symbol), symbol.name, symbol.qualifiedName, {}};
+    if (symbol.kind != "class")
+        return layoutSymbol;
+
+    for (const TagValue& tag : symbol.tags)
+    {
+        if (tag.name != "category")
+            continue;
+
+        // generate.js는 String(tag.value)를 쓰므로 @category true 같은 불리언 값도 그대로 따른다.
+        if (tag.hasBool)
+        {
+            if (tag.boolValue)
+                layoutSymbol.categories.push_back("true");
+        }
+        else if (!tag.value.empty())
+        {
+            layoutSymbol.categories.push_back(tag.value);
+        }
+    }
+    return layoutSymbol;
+}
+
+// symbolAt(ref)는 ref 심볼의 LayoutSymbol을 돌려준다.
+template<typename SymbolAt>
+static ClassLayout buildClassLayout(const ClassEntry& entry, const SymbolAt& symbolAt, bool& asciiCollation)
+{
+    ClassLayout layout;
+    layout.categories = symbolAt(entry.classSymbol).categories;
+
+    // 카테고리 이름은 개요 페이지에서 정렬된다.
+    if (!std::all_of(layout.categories.begin(), layout.categories.end(), [](const std::string& category) {
+            return isAsciiText(category);
+        }))
+        asciiCollation = false;
+
+    std::string basePath = "classes";
+    if (!layout.categories.empty())
+        basePath += "/" + sanitizeModulePath(layout.categories.front());
+    layout.link = basePath + "/" + sanitizeModulePath(entry.name);
+    layout.path = layout.link + ".mdx";
+
+    struct GroupItem
+    {
+        SymbolRef ref;
+        LayoutSymbol symbol;
+    };
+
+    std::unordered_map<std::string, std::vector<GroupItem>> groups;
+    for (const SymbolRef& member : entry.members)
+    {
+        LayoutSymbol symbol = symbolAt(member);
+        std::string group = symbol.group;
+        groups[group].push_back({member, std::move(symbol)});
+    }
+
+    std::unordered_set<std::string> usedIds;
+    for (const char* kind : kSectionOrder)
+    {
+        auto it = groups.find(kind);
+        if (it == groups.end() || it->second.empty())
+            continue;
+
+        std::vector<GroupItem>& items = it->second;
+        auto sortKey = [](const GroupItem& item) -> const std::string& {
+            return item.symbol.qualifiedName.empty() ? item.symbol.name : item.symbol.qualifiedName;
+        };
+        if (!std::all_of(items.begin(), items.end(), [&](const GroupItem& item) { return isAsciiText(sortKey(item)); }))
+            asciiCollation = false;
+        std::stable_sort(items.begin(), items.end(), [&](const GroupItem& left, const GroupItem& right) {
+            return localeCompare(sortKey(left), sortKey(right)) < 0;
+        });
+
+        LayoutSection section;
+        section.kind = kind;
+        section.label = sectionLabel(kind);
+        section.anchor = sanitizeAnchorId(section.label).value_or(section.kind);
+
+        for (const GroupItem& item : items)
+        {
+            const LayoutSymbol& symbol = item.symbol;
+            std::string headingLabel = !symbol.name.empty() ? symbol.name
+                : !symbol.qualifiedName.empty()              ? symbol.qualifiedName
+                                                             : "Unnamed";
+            section.members.push_back({item.ref, createAnchorId(symbol.name, symbol.qualifiedName, headingLabel, usedIds)});
+        }
+
+        layout.sections.push_back(std::move(section));
+    }
+
+    return layout;
+}
+
+template<typename SymbolAt>
+static ClassLayoutSet buildClassLayouts(const SymbolIndex& index, const SymbolAt& symbolAt)
+{
+    ClassLayoutSet layouts;
+    layouts.classes.reserve(index.classes.size());
+    layouts.order.reserve(index.classes.size());
+
+    for (size_t i = 0; i < index.classes.size(); ++i)
+    {
+        layouts.classes.push_back(buildClassLayout(index.classes[i], symbolAt, layouts.asciiCollation));
+        layouts.order.push_back(i);
+        if (!isAsciiText(index.classes[i].name))
+            layouts.asciiCollation = false;
+    }
+
+    std::stable_sort(layouts.order.begin(), layouts.order.end(), [&](size_t left, size_t right) {
+        return localeCompare(index.classes[left].name, index.classes[right].name) < 0;
+    });
+
+    return layouts;
+}
+
+static ClassLayoutSet buildClassLayouts(const std::vector<Module>& modules, const SymbolIndex& index)
+{
+    return buildClassLayouts(index, [&](const SymbolRef& ref) {
+        return makeLayoutSymbol(modules[ref.module].symbols[ref.symbol]);
+    });
+}
+
+// count개의 독립 작업을 하드웨어 스레드 수만큼 나눠 실행한다. 각 작업은 자기 인덱스의 결과에만 써야 한다.
+template<typename Fn>
+static void runParallel(size_t count, const Fn& work)
+{
+    size_t workerCount = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), count);
+    if (workerCount <= 1)
+    {
+        for (size_t i = 0; i < count; ++i)
+            work(i);
+        return;
+    }
+
+    std::atomic<size_t> next{0};
+    std::vector<std::thread> workers;
+    workers.reserve(workerCount);
+    for (size_t worker = 0; worker < workerCount; ++worker)
+    {
+        workers.emplace_back([&] {
+            for (size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1))
+                work(i);
+        });
+    }
+    for (std::thread& worker : workers)
+        worker.join();
+}
+
+// 사이트 검색용 사전 색인. 심볼 하나가 문서 하나이며, 문서는 클래스 페이지와 앵커로 연결된다.
+enum SearchField : uint8_t
+{
+    SearchFieldName = 1 << 0,
+    SearchFieldQualifiedName = 1 << 1,
+    SearchFieldSummary = 1 << 2,
+    SearchFieldDescription = 1 << 3,
+};
+
+static const char* const kSearchFieldNames[] = {"name", "qualifiedName", "summary", "description"};
+static constexpr size_t kMaxSearchTermLength = 64;
+
+struct SearchDocument
+{
+    SymbolRef ref;
+    size_t page = 0;
+    std::optional<std::string> anchor;
+};
+
+struct SearchPosting
+{
+    uint32_t document = 0;
+    uint8_t fields = 0;
+};
+
+struct SearchTerm
+{
+    std::string term;
+    std::vector<SearchPosting> postings;
+};
+
+struct SearchIndex
+{
+    // 페이지 순서(classOrder)대로 나열한 classes 인덱스
+    std::vector<size_t> pages;
+    std::vector<SearchDocument> documents;
+    // 바이트 순으로 정렬되어 있어 접두사 검색은 이진 탐색 후 순차 비교로 끝난다.
+    std::vector<SearchTerm> terms;
+};
+
+// <cctype> 분류는 C 로캘에 따라 0x80 이상 바이트를 문자로 볼 수 있으므로 검색 토큰은 ASCII 범위만 직접 분류한다.
+// UTF-8 바이트는 대소문자 변환 없이 단어의 일부로 둔다.
+static bool isAsciiUpper(unsigned char c)
+{
+    return c >= 'A' && c <= 'Z';
+}
+
+static bool isAsciiLower(unsigned char c)
+{
+    return c >= 'a' && c <= 'z';
+}
+
+static bool isAsciiDigit(unsigned char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+static bool isSearchWordByte(unsigned char c)
+{
+    return isAsciiUpper(c) || isAsciiLower(c) || isAsciiDigit(c) || c == '_' || c >= 0x80;
+}
+
+static void addSearchTerm(std::unordered_map<std::string, uint8_t>& terms, std::string_view word, uint8_t field, size_t minLength)
+{
+    if (word.size() < minLength || word.size() > kMaxSearchTermLength)
+        return;
+
+    // 설명 본문의 숫자만 있는 토큰은 검색어로 쓸모가 없어 버린다.
+    if (minLength > 1 && std::all_of(word.begin(), word.end(), [](char ch) {
+            return isAsciiDigit(static_cast<unsigned char>(ch));
+        }))
+        return;
+
+    std::string term(word);
+    for (char& ch : term)
+    {
+        if (isAsciiUpper(static_cast<unsigned char>(ch)))
+            ch = static_cast<char>(ch - 'A' + 'a');
+    }
+    terms[term] |= field;
+}
+
+// 단어 전체와 함께 camelCase/snake_case 조각도 색인해 getHistory를 history로도 찾게 한다.
+static void tokenizeSearchText(
+    std::string_view text,
+    uint8_t field,
+    size_t minLength,
+    std::unordered_map<std::string, uint8_t>& terms
+)
+{
+    auto isUpper = [](char ch) {
+        return isAsciiUpper(static_cast<unsigned char>(ch));
+    };
+    auto isLower = [](char ch) {
+        return isAsciiLower(static_cast<unsigned char>(ch));
+    };
+
+    size_t i = 0;
+    while (i < text.size())
+    {
+        if (!isSearchWordByte(static_cast<unsigned char>(text[i])))
+        {
+            ++i;
+            continue;
+        }
+
+        size_t start = i;
+        while (i < text.size() && isSearchWordByte(static_cast<unsigned char>(text[i])))
+            ++i;
+
+        std::string_view word = text.substr(start, i - start);
+        addSearchTerm(terms, word, field, minLength);
+
+        std::vector<std::string_view> parts;
+        size_t partStart = 0;
+        for (size_t j = 1; j <= word.size(); ++j)
+        {
+            bool atEnd = j == word.size();
+            bool underscore = !atEnd && word[j] == '_';
+            // HTTPServer처럼 대문자 연속 뒤에 소문자가 오면 마지막 대문자부터 새 조각이다.
+            bool caseBoundary = !atEnd && isUpper(word[j])
+                && (isLower(word[j - 1]) || (isUpper(word[j - 1]) && j + 1 < word.size() && isLower(word[j + 1])));
+            if (!atEnd && !underscore && !caseBoundary)
+                continue;
+
+            if (j > partStart)
+                parts.push_back(word.substr(partStart, j - partStart));
+            partStart = underscore ? j + 1 : j;
+        }
+
+        if (parts.size() > 1)
+        {
+            for (std::string_view part : parts)
+                addSearchTerm(terms, part, field, minLength);
+        }
+    }
+}
+
+static SearchIndex buildSearchIndex(const std::vector<Module>& modules, const SymbolIndex& index, const ClassLayoutSet& layouts)
+{
+    DOCGEN_TRACE_SCOPE("buildSearchIndex", "");
+
+    SearchIndex search;
+    for (size_t classIndex : layouts.order)
+    {
+        size_t page = search.pages.size();
+        search.pages.push_back(classIndex);
+        search.documents.push_back({index.classes[classIndex].classSymbol, page, std::nullopt});
+        for (const LayoutSection& section : layouts.classes[classIndex].sections)
+        {
+            for (const LayoutMember& member : section.members)
+                search.documents.push_back({member.ref, page, member.anchor});
+        }
+    }
+
+    std::vector<std::vector<uint32_t>> documentsByModule(modules.size());
+    for (size_t i = 0; i < search.documents.size(); ++i)
+        documentsByModule[search.documents[i].ref.module].push_back(static_cast<uint32_t>(i));
+
+    // 모듈 단위로 토큰화한다. 작업자는 자기 모듈의 결과 벡터에만 쓰므로 잠금이 필요 없다.
+    std::vector<std::vector<std::pair<std::string, SearchPosting>>> moduleTerms(modules.size());
+    auto tokenizeModule = [&](size_t moduleIndex) {
+        std::unordered_map<std::string, uint8_t> terms;
+        std::vector<std::pair<std::string, SearchPosting>>& out = moduleTerms[moduleIndex];
+        for (uint32_t documentIndex : documentsByModule[moduleIndex])
+        {
+            const Symbol& symbol = modules[moduleIndex].symbols[search.documents[documentIndex].ref.symbol];
+            terms.clear();
+            tokenizeSearchText(symbol.name, SearchFieldName, 1, terms);
+            tokenizeSearchText(symbol.qualifiedName, SearchFieldQualifiedName, 1, terms);
+            tokenizeSearchText(symbol.summary, SearchFieldSummary, 2, terms);
+            tokenizeSearchText(symbol.descriptionMarkdown, SearchFieldDescription, 2, terms);
+
+            for (auto& [term, fields] : terms)
+                out.push_back({term, {documentIndex, fields}});
+        }
+    };
+
+    runParallel(modules.size(), tokenizeModule);
+
+    size_t total = 0;
+    for (const auto& entries : moduleTerms)
+        total += entries.size();
+
+    std::vector<std::pair<std::string, SearchPosting>> entries;
+    entries.reserve(total);
+    for (auto& moduleEntries : moduleTerms)
+    {
+        std::move(moduleEntries.begin(), moduleEntries.end(), std::back_inserter(entries));
+        moduleEntries = {};
+    }
+
+    // 스레드 수와 관계없이 같은 출력이 나오도록 (term, 문서 번호)로 정렬해 병합한다.
+    std::sort(entries.begin(), entries.end(), [](const auto& left, const auto& right) {
+        if (left.first != right.first)
+            return left.first < right.first;
+        return left.second.document < right.second.document;
+    });
+
+    for (auto& [term, posting] : entries)
+    {
+        if (search.terms.empty() || search.terms.back().term != term)
+            search.terms.push_back({std::move(term), {}});
+        search.terms.back().postings.push_back(posting);
+    }
+
+    return search;
+}
+
+static std::unordered_map<std::string, std::string> loadModuleOverrides(const fs::path& rootDir)
+{
+    fs::path configPath = rootDir / "docs.config.json";
+    if (!fs::exists(configPath))
+        return {};
+
+    Source source = loadSource(configPath);
+    std::string content = source.content;
+    size_t pos = content.find("\"moduleIdOverrides\"");
+    if (pos == std::string::npos)
+        return {};
+
+    size_t brace = content.find("{", pos);
+    if (brace == std::string::npos)
+        return {};
+
+    size_t depth = 0;
+    size_t end = brace;
+    for (; end < content.size(); ++end)
+    {
+        if (content[end] == '{')
+            depth++;
+        else if (content[end] == '}')
+        {
+            depth--;
+            if (depth == 0)
+                break;
+        }
+    }
+
+    if (end >= content.size())
+        return {};
+
+    std::string objectText = content.substr(brace + 1, end - brace - 1);
+    std::unordered_map<std::string, std::string> overrides;
+    size_t cursor = 0;
+    while (cursor < objectText.size())
+    {
+        size_t keyStart = objectText.find('"', cursor);
+        if (keyStart == std::string::npos)
+            break;
+        size_t keyEnd = objectText.find('"', keyStart + 1);
+        if (keyEnd == std::string::npos)
+            break;
+        std::string key = objectText.substr(keyStart + 1, keyEnd - keyStart - 1);
+
+        size_t valueStart = objectText.find('"', keyEnd + 1);
+        if (valueStart == std::string::npos)
+            break;
+        size_t valueEnd = objectText.find('"', valueStart + 1);
+        if (valueEnd == std::string::npos)
+            break;
+        std::string value = objectText.substr(valueStart + 1, valueEnd - valueStart - 1);
+
+        std::replace(key.begin(), key.end(), '\\', '/');
+        overrides[key] = value;
+        cursor = valueEnd + 1;
+    }
+
+    return overrides;
+}
+
+static std::vector<fs::path> collectFiles(const fs::path& rootDir)
+{
+    std::vector<fs::path> files;
+    if (!fs::exists(rootDir))
+        return files;
+
+    for (auto& entry : fs::directory_iterator(rootDir))
+    {
+        fs::path entryPath = entry.path();
+        std::string name = entryPath.filename().string();
+        if (!name.empty() && name[0] == '.')
+            continue;
+
+        if (entry.is_directory())
+        {
+            if (name == "node_modules")
+                continue;
+            std::vector<fs::path> nested = collectFiles(entryPath);
+            files.insert(files.end(), nested.begin(), nested.end());
+            continue;
+        }
+
+        std::string ext = entryPath.extension().string();
+        if (ext == ".luau" || ext == ".lua")
+            files.push_back(entryPath);
+    }
+
+    return files;
+}
+
+static std::string sha1(const std::string& input)
+{
+    uint32_t h0 = 0x67452301;
+    uint32_t h1 = 0xEFCDAB89;
+    uint32_t h2 = 0x98BADCFE;
+    uint32_t h3 = 0x10325476;
+    uint32_t h4 = 0xC3D2E1F0;
+
+    std::vector<uint8_t> data(input.begin(), input.end());
+    uint64_t bitLen = static_cast<uint64_t>(data.size()) * 8;
+
+    data.push_back(0x80);
+    while ((data.size() * 8) % 512 != 448)
+        data.push_back(0x00);
+
+    for (int i = 7; i >= 0; --i)
+        data.push_back(static_cast<uint8_t>((bitLen >> (i * 8)) & 0xff));
+
+    for (size_t chunk = 0; chunk < data.size(); chunk += 64)
+    {
+        uint32_t w[80] = {0};
+        for (int i = 0; i < 16; ++i)
+        {
+            w[i] = (data[chunk + i * 4 + 0] << 24) |
+                   (data[chunk + i * 4 + 1] << 16) |
+                   (data[chunk + i * 4 + 2] << 8) |
+                   (data[chunk + i * 4 + 3]);
+        }
+        for (int i = 16; i < 80; ++i)
+        {
+            uint32_t value = w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16];
+            w[i] = (value << 1) | (value >> 31);
+        }
+
+        uint32_t a = h0;
+        uint32_t b = h1;
+        uint32_t c = h2;
+        uint32_t d = h3;
+        uint32_t e = h4;
+
+        for (int i = 0; i < 80; ++i)
+        {
+            uint32_t f;
+            uint32_t k;
+            if (i < 20)
+            {
+                f = (b & c) | ((~b) & d);
+                k = 0x5A827999;
+            }
+            else if (i < 40)
+            {
+                f = b ^ c ^ d;
+                k = 0x6ED9EBA1;
+            }
+            else if (i < 60)
+            {
+                f = (b & c) | (b & d) | (c & d);
+                k = 0x8F1BBCDC;
+            }
+            else
+            {
+                f = b ^ c ^ d;
+                k = 0xCA62C1D6;
+            }
+
+            uint32_t temp = ((a << 5) | (a >> 27)) + f + e + k + w[i];
+            e = d;
+            d = c;
+            c = (b << 30) | (b >> 2);
+            b = a;
+            a = temp;
+        }
+
+        h0 += a;
+        h1 += b;
+        h2 += c;
+        h3 += d;
+        h4 += e;
+    }
+
+    std::ostringstream out;
+    out << std::hex << std::nouppercase;
+    out << std::setw(8) << std::setfill('0') << h0;
+    out << std::setw(8) << std::setfill('0') << h1;
+    out << std::setw(8) << std::setfill('0') << h2;
+    out << std::setw(8) << std::setfill('0') << h3;
+    out << std::setw(8) << std::setfill('0') << h4;
+    return out.str();
+}
+
+class JsonWriter
+{
+public:
+    // compact면 줄바꿈과 들여쓰기 없이 쓴다. 사이트가 그대로 내려받는 산출물에 쓴다.
+    explicit JsonWriter(std::ostream& out, bool compact = false)
+        : out(out)
+        , compact(compact)
+    {
+    }
+
+    void beginObject()
+    {
+        writeCommaIfNeeded();
+        out << "{";
+        pushContext(true);
+    }
+
+    void endObject()
+    {
+        if (contextStack.empty())
+            return;
+        Context ctx = contextStack.back();
+        popContext();
+        if (ctx.first || compact)
+        {
+            out << "}";
+            return;
+        }
+        out << "\n";
+        writeIndent();
+        out << "}";
+    }
+
+    void beginArray()
+    {
+        writeCommaIfNeeded();
+        out << "[";
+        pushContext(false);
+    }
+
+    void endArray()
+    {
+        if (contextStack.empty())
+            return;
+        Context ctx = contextStack.back();
+        popContext();
+        if (ctx.first || compact)
+        {
+            out << "]";
+            return;
+        }
+        out << "\n";
+        writeIndent();
+        out << "]";
+    }
+
+    void key(const std::string& name)
+    {
+        if (!contextStack.empty())
+        {
+            Context& ctx = contextStack.back();
+            if (!ctx.first)
+                out << ",";
+            ctx.first = false;
+        }
+        if (compact)
+        {
+            writeString(name);
+            out << ":";
+            return;
+        }
+        out << "\n";
+        writeIndent();
+        writeString(name);
+        out << ": ";
+    }
+
+    void valueString(const std::string& value)
+    {
+        writeCommaIfNeeded();
+        writeString(value);
+    }
+
+    void valueNumber(int value)
+    {
+        writeCommaIfNeeded();
+        out << value;
+    }
+
+    void valueNumber(long long value)
+    {
+        writeCommaIfNeeded();
+        out << value;
+    }
+
+    void valueBool(bool value)
+    {
+        writeCommaIfNeeded();
+        out << (value ? "true" : "false");
+    }
+
+    void valueNull()
+    {
+        writeCommaIfNeeded();
+        out << "null";
+    }
+
+private:
+    struct Context
+    {
+        bool isObject;
+        bool first = true;
+    };
+
+    std::ostream& out;
+    bool compact = false;
+    std::vector<Context> contextStack;
+
+    void pushContext(bool isObject)
+    {
+        contextStack.push_back({isObject, true});
+    }
+
+    void popContext()
+    {
+        if (!contextStack.empty())
+            contextStack.pop_back();
+    }
+
+    void writeIndent(int extra = 0)
+    {
+        size_t total = contextStack.size() + extra;
+        for (size_t i = 0; i < total; ++i)
+            out << "  ";
+    }
+
+    void writeCommaIfNeeded()
+    {
+        if (contextStack.empty())
+            return;
+        Context& ctx = contextStack.back();
+        if (ctx.isObject)
+            return;
+        if (!ctx.first)
+            out << ",";
+        ctx.first = false;
+        if (compact)
+            return;
+        out << "\n";
+        writeIndent();
+    }
+
+    void writeString(const std::string& value)
+    {
+        out << "\"";
+        for (char ch : value)
+        {
+            switch (ch)
+            {
+            case '\\':
+                out << "\\\\";
+                break;
+            case '"':
+                out << "\\\"";
+                break;
+            case '\n':
+                out << "\\n";
+                break;
+            case '\r':
+                out << "\\r";
+                break;
+            case '\t':
+                out << "\\t";
+                break;
+            default:
+                out << ch;
+                break;
+            }
+        }
+        out << "\"";
+    }
+};
+
+struct JsonValue
+{
+    enum class Kind
+    {
+        Null,
+        Bool,
+        Number,
+        String,
+        Array,
+        Object,
+    };
+
+    Kind kind = Kind::Null;
+    bool boolValue = false;
+    double numberValue = 0.0;
+    std::string stringValue;
+    std::vector<JsonValue> items;
+    std::vector<std::pair<std::string, JsonValue>> members;
+
+    const JsonValue* find(const std::string& name) const
+    {
+        if (kind != Kind::Object)
+            return nullptr;
+
+        // JSON.parse처럼 같은 키가 여러 번 나오면 마지막 값을 쓴다.
+        for (auto it = members.rbegin(); it != members.rend(); ++it)
+        {
+            if (it->first == name)
+                return &it->second;
+        }
+        return nullptr;
+    }
+};
+
+// 렌더 옵션처럼 호출자가 넘기는 작은 설정 JSON을 읽는 파서. 형식이 틀리면 nullopt를 돌려준다.
+class JsonReader
+{
+public:
+    explicit JsonReader(std::string_view text)
+        : text(text)
+    {
+    }
+
+    std::optional<JsonValue> parse()
+    {
+        skipWhitespace();
+        std::optional<JsonValue> value = parseValue(0);
+        skipWhitespace();
+        if (!value || pos != text.size())
+            return std::nullopt;
+        return value;
+    }
+
+private:
+    static constexpr int kMaxDepth = 64;
+
+    std::string_view text;
+    size_t pos = 0;
+
+    void skipWhitespace()
+    {
+        while (pos < text.size() && (text[pos] == ' ' || text[pos] == '\t' || text[pos] == '\n' || text[pos] == '\r'))
+            pos++;
+    }
+
+    bool consume(char expected)
+    {
+        if (pos < text.size() && text[pos] == expected)
+        {
+            pos++;
+            return true;
+        }
+        return false;
+    }
+
+    bool consumeLiteral(std::string_view literal)
+    {
+        if (text.substr(pos, literal.size()) != literal)
+            return false;
+        pos += literal.size();
+        return true;
+    }
+
+    std::optional<JsonValue> parseValue(int depth)
+    {
+        if (depth > kMaxDepth || pos >= text.size())
+            return std::nullopt;
+
+        JsonValue value;
+        char c = text[pos];
+        if (c == '{')
+            return parseObject(depth);
+        if (c == '[')
+            return parseArray(depth);
+        if (c == '"')
+        {
+            std::optional<std::string> str = parseString();
+            if (!str)
+                return std::nullopt;
+            value.kind = JsonValue::Kind::String;
+            value.stringValue = std::move(*str);
+            return value;
+        }
+        if (consumeLiteral("true"))
+        {
+            value.kind = JsonValue::Kind::Bool;
+            value.boolValue = true;
+            return value;
+        }
+        if (consumeLiteral("false"))
+        {
+            value.kind = JsonValue::Kind::Bool;
+            return value;
+        }
+        if (consumeLiteral("null"))
+            return value;
+
+        size_t start = pos;
+        while (pos < text.size() && std::strchr("+-0123456789.eE", text[pos]) != nullptr)
+            pos++;
+        if (start == pos)
+            return std::nullopt;
+
+        std::string number(text.substr(start, pos - start));
+        char* end = nullptr;
+        value.kind = JsonValue::Kind::Number;
+        value.numberValue = std::strtod(number.c_str(), &end);
+        if (end != number.c_str() + number.size())
+            return std::nullopt;
+        return value;
+    }
+
+    std::optional<JsonValue> parseObject(int depth)
+    {
+        JsonValue value;
+        value.kind = JsonValue::Kind::Object;
+        pos++;
+        skipWhitespace();
+        if (consume('}'))
+            return value;
+
+        while (true)
+        {
+            skipWhitespace();
+            if (pos >= text.size() || text[pos] != '"')
+                return std::nullopt;
+            std::optional<std::string> key = parseString();
+            if (!key)
+                return std::nullopt;
+
+            skipWhitespace();
+            if (!consume(':'))
+                return std::nullopt;
+            skipWhitespace();
+
+            std::optional<JsonValue> member = parseValue(depth + 1);
+            if (!member)
+                return std::nullopt;
+            value.members.push_back({std::move(*key), std::move(*member)});
+
+            skipWhitespace();
+            if (consume('}'))
+                return value;
+            if (!consume(','))
+                return std::nullopt;
+        }
+    }
+
+    std::optional<JsonValue> parseArray(int depth)
+    {
+        JsonValue value;
+        value.kind = JsonValue::Kind::Array;
+        pos++;
+        skipWhitespace();
+        if (consume(']'))
+            return value;
+
+        while (true)
+        {
+            skipWhitespace();
+            std::optional<JsonValue> item = parseValue(depth + 1);
+            if (!item)
+                return std::nullopt;
+            value.items.push_back(std::move(*item));
+
+            skipWhitespace();
+            if (consume(']'))
+                return value;
+            if (!consume(','))
+                return std::nullopt;
+        }
+    }
+
+    std::optional<unsigned> parseHex4()
+    {
+        if (pos + 4 > text.size())
+            return std::nullopt;
+
+        unsigned value = 0;
+        for (int i = 0; i < 4; ++i)
+        {
+            char c = text[pos++];
+            value <<= 4;
+            if (c >= '0' && c <= '9')
+                value |= c - '0';
+            else if (c >= 'a' && c <= 'f')
+                value |= c - 'a' + 10;
+            else if (c >= 'A' && c <= 'F')
+                value |= c - 'A' + 10;
+            else
+                return std::nullopt;
+        }
+        return value;
+    }
+
+    static void appendUtf8(std::string& out, unsigned codepoint)
+    {
+        if (codepoint < 0x80)
+        {
+            out.push_back(static_cast<char>(codepoint));
+        }
+        else if (codepoint < 0x800)
+        {
+            out.push_back(static_cast<char>(0xC0 | (codepoint >> 6)));
+            out.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+        }
+        else if (codepoint < 0x10000)
+        {
+            out.push_back(static_cast<char>(0xE0 | (codepoint >> 12)));
+            out.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+        }
+        else
+        {
+            out.push_back(static_cast<char>(0xF0 | (codepoint >> 18)));
+            out.push_back(static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+        }
+    }
+
+    std::optional<std::string> parseString()
+    {
+        pos++;
+        std::string out;
+        while (pos < text.size())
+        {
+            char c = text[pos++];
+            if (c == '"')
+                return out;
+            if (c != '\\')
+            {
+                out.push_back(c);
+                continue;
+            }
+
+            if (pos >= text.size())
+                return std::nullopt;
+
+            char escape = text[pos++];
+            switch (escape)
+            {
+            case '"':
+            case '\\':
+            case '/':
+                out.push_back(escape);
+                break;
+            case 'b':
+                out.push_back('\b');
+                break;
+            case 'f':
+                out.push_back('\f');
+                break;
+            case 'n':
+                out.push_back('\n');
+                break;
+            case 'r':
+                out.push_back('\r');
+                break;
+            case 't':
+                out.push_back('\t');
+                break;
+            case 'u':
+            {
+                std::optional<unsigned> unit = parseHex4();
+                if (!unit)
+                    return std::nullopt;
+
+                unsigned codepoint = *unit;
+                if (codepoint >= 0xD800 && codepoint <= 0xDBFF && text.substr(pos, 2) == "\\u")
+                {
+                    size_t saved = pos;
+                    pos += 2;
+                    std::optional<unsigned> low = parseHex4();
+                    if (low && *low >= 0xDC00 && *low <= 0xDFFF)
+                        codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (*low - 0xDC00);
+                    else
+                        pos = saved;
+                }
+                appendUtf8(out, codepoint);
+                break;
+            }
+            default:
+                return std::nullopt;
+            }
+        }
+        return std::nullopt;
+    }
+};
+
+static void writeTagArray(JsonWriter& writer, const std::vector<TagValue>& tags)
+{
+    writer.beginArray();
+    for (const TagValue& tag : tags)
+    {
+        writer.beginObject();
+        writer.key("name");
+        writer.valueString(tag.name);
+        writer.key("value");
+        if (tag.hasBool)
+            writer.valueBool(tag.boolValue);
+        else
+            writer.valueString(tag.value);
+        if (!tag.description.empty())
+        {
+            writer.key("description");
+            writer.valueString(tag.description);
+        }
+        writer.endObject();
+    }
+    writer.endArray();
+}
+
+static std::string joinDescriptionLines(const std::vector<std::string>& lines)
+{
+    std::string desc;
+    for (size_t i = 0; i < lines.size(); ++i)
+    {
+        if (i > 0)
+            desc += "\n";
+        desc += trim(lines[i]);
+    }
+    return trim(desc);
+}
+
+static void writeParams(JsonWriter& writer, const std::vector<ParamInfo>& params)
+{
+    writer.beginArray();
+    for (const ParamInfo& param : params)
+    {
+        writer.beginObject();
+        writer.key("name");
+        writer.valueString(param.name);
+        writer.key("type");
+        if (param.type.empty())
+            writer.valueNull();
+        else
+            writer.valueString(param.type);
+        writer.key("description");
+        std::string desc = joinDescriptionLines(param.description);
+        if (desc.empty())
+            writer.valueNull();
+        else
+            writer.valueString(desc);
+        writer.endObject();
+    }
+    writer.endArray();
+}
+
+static void writeReturns(JsonWriter& writer, const std::vector<ReturnInfo>& returns)
+{
+    writer.beginArray();
+    for (const ReturnInfo& ret : returns)
+    {
+        writer.beginObject();
+        writer.key("type");
+        if (ret.type.empty())
+            writer.valueNull();
+        else
+            writer.valueString(ret.type);
+        writer.key("description");
+        std::string desc = joinDescriptionLines(ret.description);
+        if (desc.empty())
+            writer.valueNull();
+        else
+            writer.valueString(desc);
+        writer.endObject();
+    }
+    writer.endArray();
+}
+
+static void writeErrors(JsonWriter& writer, const std::vector<ErrorInfo>& errors)
+{
+    writer.beginArray();
+    for (const ErrorInfo& err : errors)
+    {
+        writer.beginObject();
+        writer.key("type");
+        if (err.type.empty())
+            writer.valueNull();
+        else
+            writer.valueString(err.type);
+        writer.key("description");
+        std::string desc = joinDescriptionLines(err.description);
+        if (desc.empty())
+            writer.valueNull();
+        else
+            writer.valueString(desc);
+        writer.endObject();
+    }
+    writer.endArray();
+}
+
+static void writeFields(JsonWriter& writer, const std::vector<FieldInfo>& fields)
+{
+    writer.beginArray();
+    for (const FieldInfo& field : fields)
+    {
+        writer.beginObject();
+        writer.key("name");
+        writer.valueString(field.name);
         writer.key("type");
-        if (ret.type.empty())
+        if (field.type.empty())
+            writer.valueNull();
+        else
+            writer.valueString(field.type);
+        writer.key("description");
+        if (field.description.empty())
+            writer.valueNull();
+        else
+            writer.valueString(field.description);
+        writer.endObject();
+    }
+    writer.endArray();
+}
+
+static void writeSymbol(JsonWriter& writer, const Symbol& symbol)
+{
+    writer.beginObject();
+    writer.key("kind");
+    writer.valueString(symbol.kind);
+    writer.key("name");
+    writer.valueString(symbol.name);
+    writer.key("qualifiedName");
+    writer.valueString(symbol.qualifiedName);
+    writer.key("location");
+    writer.beginObject();
+    writer.key("file");
+    writer.valueString(symbol.file);
+    writer.key("line");
+    writer.valueNumber(symbol.line);
+    writer.key("column");
+    writer.valueNumber(symbol.column);
+    writer.endObject();
+
+    writer.key("docs");
+    writer.beginObject();
+    writer.key("summary");
+    writer.valueString(symbol.summary);
+    writer.key("descriptionMarkdown");
+    writer.valueString(symbol.descriptionMarkdown);
+    writer.key("tags");
+    writeTagArray(writer, symbol.tags);
+    writer.key("examples");
+    writer.beginArray();
+    writer.endArray();
+    writer.endObject();
+
+    writer.key("types");
+    writer.beginObject();
+    writer.key("display");
+    writer.valueString(symbol.types.display);
+    writer.key("structured");
+    writer.beginObject();
+    if (symbol.kind == "function" || symbol.kind == "constructor")
+    {
+        writer.key("params");
+        writeParams(writer, symbol.types.params);
+        writer.key("returns");
+        writeReturns(writer, symbol.types.returns);
+        writer.key("errors");
+        writeErrors(writer, symbol.types.errors);
+        writer.key("yields");
+        writer.valueBool(symbol.types.yields);
+    }
+    else if (symbol.kind == "property")
+    {
+        writer.key("type");
+        if (symbol.types.propertyType.empty())
+            writer.valueNull();
+        else
+            writer.valueString(symbol.types.propertyType);
+        writer.key("readonly");
+        writer.valueBool(symbol.types.readonly);
+    }
+    else if (symbol.kind == "interface")
+    {
+        writer.key("fields");
+        writeFields(writer, symbol.types.fields);
+    }
+    else if (symbol.kind == "type")
+    {
+        writer.key("type");
+        if (symbol.types.typeAlias.empty())
+            writer.valueNull();
+        else
+            writer.valueString(symbol.types.typeAlias);
+    }
+    else if (symbol.kind == "class")
+    {
+        writer.key("indexName");
+        if (symbol.types.indexName.empty())
+            writer.valueNull();
+        else
+            writer.valueString(symbol.types.indexName);
+    }
+    else if (symbol.kind == "field")
+    {
+        writer.key("type");
+        if (symbol.types.propertyType.empty())
+            writer.valueNull();
+        else
+            writer.valueString(symbol.types.propertyType);
+    }
+    writer.endObject();
+    writer.endObject();
+
+    writer.key("visibility");
+    writer.valueString(symbol.visibility);
+
+    writer.endObject();
+}
+
+static void writeSymbolRef(JsonWriter& writer, const SymbolRef& ref)
+{
+    writer.beginObject();
+    writer.key("module");
+    writer.valueNumber(static_cast<int>(ref.module));
+    writer.key("symbol");
+    writer.valueNumber(static_cast<int>(ref.symbol));
+    writer.endObject();
+}
+
+static void writeClassLayout(JsonWriter& writer, const ClassLayout& layout)
+{
+    writer.beginObject();
+    writer.key("path");
+    writer.valueString(layout.path);
+    writer.key("link");
+    writer.valueString(layout.link);
+    writer.key("categories");
+    writer.beginArray();
+    for (const std::string& category : layout.categories)
+        writer.valueString(category);
+    writer.endArray();
+    writer.key("sections");
+    writer.beginArray();
+    for (const LayoutSection& section : layout.sections)
+    {
+        writer.beginObject();
+        writer.key("kind");
+        writer.valueString(section.kind);
+        writer.key("label");
+        writer.valueString(section.label);
+        writer.key("anchor");
+        writer.valueString(section.anchor);
+        writer.key("members");
+        writer.beginArray();
+        for (const LayoutMember& member : section.members)
+        {
+            writer.beginObject();
+            writer.key("module");
+            writer.valueNumber(static_cast<int>(member.ref.module));
+            writer.key("symbol");
+            writer.valueNumber(static_cast<int>(member.ref.symbol));
+            writer.key("anchor");
+            if (member.anchor)
+                writer.valueString(*member.anchor);
+            else
+                writer.valueNull();
+            writer.endObject();
+        }
+        writer.endArray();
+        writer.endObject();
+    }
+    writer.endArray();
+    writer.endObject();
+}
+
+static void writeClassIndex(JsonWriter& writer, const SymbolIndex& index, const ClassLayoutSet* layouts)
+{
+    writer.beginArray();
+    for (size_t i = 0; i < index.classes.size(); ++i)
+    {
+        const ClassEntry& entry = index.classes[i];
+        writer.beginObject();
+        writer.key("name");
+        writer.valueString(entry.name);
+        writer.key("symbol");
+        writeSymbolRef(writer, entry.classSymbol);
+        writer.key("extends");
+        writer.beginArray();
+        for (const ClassExtends& extends : entry.extends)
+        {
+            writer.beginObject();
+            writer.key("name");
+            writer.valueString(extends.name);
+            writer.key("class");
+            if (extends.classIndex)
+                writer.valueNumber(static_cast<int>(*extends.classIndex));
+            else
+                writer.valueNull();
+            writer.endObject();
+        }
+        writer.endArray();
+        writer.key("members");
+        writer.beginArray();
+        for (const SymbolRef& member : entry.members)
+            writeSymbolRef(writer, member);
+        writer.endArray();
+        if (layouts)
+        {
+            writer.key("layout");
+            writeClassLayout(writer, layouts->classes[i]);
+        }
+        writer.endObject();
+    }
+    writer.endArray();
+}
+
+// 페이지 순서(클래스 이름의 localeCompare 순)로 나열한 classes 인덱스
+static void writeClassOrder(JsonWriter& writer, const ClassLayoutSet& layouts)
+{
+    writer.key("classOrder");
+    writer.beginArray();
+    for (size_t classIndex : layouts.order)
+        writer.valueNumber(static_cast<int>(classIndex));
+    writer.endArray();
+}
+
+static void writeModule(JsonWriter& writer, const Module& module)
+{
+    writer.beginObject();
+    writer.key("id");
+    writer.valueString(module.id);
+    writer.key("path");
+    writer.valueString(module.path);
+    writer.key("sourceHash");
+    writer.valueString(module.sourceHash);
+    writer.key("symbols");
+    writer.beginArray();
+    for (const Symbol& symbol : module.symbols)
+        writeSymbol(writer, symbol);
+    writer.endArray();
+    writer.endObject();
+}
+
+// schemaVersion 2: 반복되는 문자열(파일 경로, 종류, visibility, 타입 표시 등)을 strings에 한 번만 쓰고
+// 심볼은 키 없는 배열에 그 번호를 담는다. 많이 나오는 문자열이 작은 번호를 받는다.
+// 펼치는 쪽은 docusaurus-plugin-reference의 expandReferenceJson이다.
+class JsonStringTable
+{
+public:
+    // value가 모듈 데이터처럼 표가 쓰일 동안 살아 있는 문자열일 때 쓴다.
+    void add(std::string_view value)
+    {
+        auto it = entries.find(value);
+        if (it == entries.end())
+            it = entries.emplace(value, Entry{entries.size(), 0, 0}).first;
+        it->second.count++;
+    }
+
+    // 파라미터 설명처럼 쓸 때마다 새로 계산하는 문자열은 표가 사본을 들고 있는다.
+    void addOwned(std::string value)
+    {
+        auto it = entries.find(value);
+        if (it == entries.end())
+            it = entries.emplace(owned.emplace_back(std::move(value)), Entry{entries.size(), 0, 0}).first;
+        it->second.count++;
+    }
+
+    void finalize()
+    {
+        sorted.clear();
+        sorted.reserve(entries.size());
+        for (auto& item : entries)
+            sorted.push_back(&item);
+        std::sort(sorted.begin(), sorted.end(), [](const auto* left, const auto* right) {
+            if (left->second.count != right->second.count)
+                return left->second.count > right->second.count;
+            return left->second.firstSeen < right->second.firstSeen;
+        });
+        for (size_t i = 0; i < sorted.size(); ++i)
+            sorted[i]->second.index = i;
+    }
+
+    int indexOf(std::string_view value) const
+    {
+        return static_cast<int>(entries.at(value).index);
+    }
+
+    void write(JsonWriter& writer) const
+    {
+        writer.beginArray();
+        for (const auto* entry : sorted)
+            writer.valueString(std::string(entry->first));
+        writer.endArray();
+    }
+
+private:
+    struct Entry
+    {
+        size_t firstSeen = 0;
+        size_t count = 0;
+        size_t index = 0;
+    };
+
+    std::unordered_map<std::string_view, Entry> entries;
+    std::vector<std::pair<const std::string_view, Entry>*> sorted;
+    std::deque<std::string> owned;
+};
+
+// writeSymbolCompact가 번호로 쓰는 문자열을 빠짐없이 모은다. 빠진 문자열은 indexOf에서 예외가 난다.
+static void collectSymbolStrings(JsonStringTable& table, const Symbol& symbol)
+{
+    table.add(symbol.kind);
+    table.add(symbol.name);
+    table.add(symbol.qualifiedName);
+    table.add(symbol.file);
+    table.add(symbol.summary);
+    table.add(symbol.descriptionMarkdown);
+    for (const TagValue& tag : symbol.tags)
+    {
+        table.add(tag.name);
+        if (!tag.hasBool)
+            table.add(tag.value);
+        if (!tag.description.empty())
+            table.add(tag.description);
+    }
+    table.add(symbol.types.display);
+    table.add(symbol.visibility);
+
+    const SymbolTypes& types = symbol.types;
+    if (symbol.kind == "function" || symbol.kind == "constructor")
+    {
+        for (const ParamInfo& param : types.params)
+        {
+            table.add(param.name);
+            table.add(param.type);
+            table.addOwned(joinDescriptionLines(param.description));
+        }
+        for (const ReturnInfo& ret : types.returns)
+        {
+            table.add(ret.type);
+            table.addOwned(joinDescriptionLines(ret.description));
+        }
+        for (const ErrorInfo& err : types.errors)
+        {
+            table.add(err.type);
+            table.addOwned(joinDescriptionLines(err.description));
+        }
+    }
+    else if (symbol.kind == "property" || symbol.kind == "field")
+    {
+        table.add(types.propertyType);
+    }
+    else if (symbol.kind == "interface")
+    {
+        for (const FieldInfo& field : types.fields)
+        {
+            table.add(field.name);
+            table.add(field.type);
+            table.add(field.description);
+        }
+    }
+    else if (symbol.kind == "type")
+    {
+        table.add(types.typeAlias);
+    }
+    else if (symbol.kind == "class")
+    {
+        table.add(types.indexName);
+    }
+}
+
+static void writeStringRef(JsonWriter& writer, const JsonStringTable& table, std::string_view value)
+{
+    writer.valueNumber(table.indexOf(value));
+}
+
+// v1에서 빈 문자열을 null로 쓰던 자리는 그대로 null을 쓴다.
+static void writeOptionalStringRef(JsonWriter& writer, const JsonStringTable& table, std::string_view value)
+{
+    if (value.empty())
+        writer.valueNull();
+    else
+        writer.valueNumber(table.indexOf(value));
+}
+
+// [kind, name, qualifiedName, file, line, column, summary, descriptionMarkdown, tags, display, structured, visibility]
+// tags: [name, value(번호 또는 bool), description?]
+// structured는 종류별 배열이다.
+//   function/constructor: [params [name, type, description], returns [type, description], errors, yields]
+//   property: [type, readonly], field/type: [type], interface: [fields [name, type, description]], class: [indexName]
+static void writeSymbolCompact(JsonWriter& writer, const JsonStringTable& table, const Symbol& symbol)
+{
+    writer.beginArray();
+    writeStringRef(writer, table, symbol.kind);
+    writeStringRef(writer, table, symbol.name);
+    writeStringRef(writer, table, symbol.qualifiedName);
+    writeStringRef(writer, table, symbol.file);
+    writer.valueNumber(symbol.line);
+    writer.valueNumber(symbol.column);
+    writeStringRef(writer, table, symbol.summary);
+    writeStringRef(writer, table, symbol.descriptionMarkdown);
+
+    writer.beginArray();
+    for (const TagValue& tag : symbol.tags)
+    {
+        writer.beginArray();
+        writeStringRef(writer, table, tag.name);
+        if (tag.hasBool)
+            writer.valueBool(tag.boolValue);
+        else
+            writeStringRef(writer, table, tag.value);
+        if (!tag.description.empty())
+            writeStringRef(writer, table, tag.description);
+        writer.endArray();
+    }
+    writer.endArray();
+
+    writeStringRef(writer, table, symbol.types.display);
+
+    const SymbolTypes& types = symbol.types;
+    writer.beginArray();
+    if (symbol.kind == "function" || symbol.kind == "constructor")
+    {
+        writer.beginArray();
+        for (const ParamInfo& param : types.params)
+        {
+            writer.beginArray();
+            writeStringRef(writer, table, param.name);
+            writeOptionalStringRef(writer, table, param.type);
+            writeOptionalStringRef(writer, table, joinDescriptionLines(param.description));
+            writer.endArray();
+        }
+        writer.endArray();
+        writer.beginArray();
+        for (const ReturnInfo& ret : types.returns)
+        {
+            writer.beginArray();
+            writeOptionalStringRef(writer, table, ret.type);
+            writeOptionalStringRef(writer, table, joinDescriptionLines(ret.description));
+            writer.endArray();
+        }
+        writer.endArray();
+        writer.beginArray();
+        for (const ErrorInfo& err : types.errors)
+        {
+            writer.beginArray();
+            writeOptionalStringRef(writer, table, err.type);
+            writeOptionalStringRef(writer, table, joinDescriptionLines(err.description));
+            writer.endArray();
+        }
+        writer.endArray();
+        writer.valueBool(types.yields);
+    }
+    else if (symbol.kind == "property")
+    {
+        writeOptionalStringRef(writer, table, types.propertyType);
+        writer.valueBool(types.readonly);
+    }
+    else if (symbol.kind == "interface")
+    {
+        writer.beginArray();
+        for (const FieldInfo& field : types.fields)
+        {
+            writer.beginArray();
+            writeStringRef(writer, table, field.name);
+            writeOptionalStringRef(writer, table, field.type);
+            writeOptionalStringRef(writer, table, field.description);
+            writer.endArray();
+        }
+        writer.endArray();
+    }
+    else if (symbol.kind == "type")
+    {
+        writeOptionalStringRef(writer, table, types.typeAlias);
+    }
+    else if (symbol.kind == "class")
+    {
+        writeOptionalStringRef(writer, table, types.indexName);
+    }
+    else if (symbol.kind == "field")
+    {
+        writeOptionalStringRef(writer, table, types.propertyType);
+    }
+    writer.endArray();
+
+    writeStringRef(writer, table, symbol.visibility);
+    writer.endArray();
+}
+
+// [id, path, sourceHash, symbols]
+static void writeModuleCompact(JsonWriter& writer, const JsonStringTable& table, const Module& module)
+{
+    writer.beginArray();
+    writeStringRef(writer, table, module.id);
+    writeStringRef(writer, table, module.path);
+    writer.valueString(module.sourceHash);
+    writer.beginArray();
+    for (const Symbol& symbol : module.symbols)
+        writeSymbolCompact(writer, table, symbol);
+    writer.endArray();
+    writer.endArray();
+}
+
+struct MdxRenderResult
+{
+    fs::path outDir;
+    size_t pages = 0;
+    std::vector<std::string> failedPaths;
+    std::string optionsHash;
+    // 정렬 키가 모두 ASCII일 때만 페이지 순서가 generate.js와 같다고 보장된다.
+    bool asciiCollation = true;
+};
+
+static void writeJsonOutput(
+    const std::vector<Module>& modules,
+    const SymbolIndex& index,
+    const std::string& generatorVersion,
+    int schemaVersion,
+    const ClassLayoutSet* layouts,
+    const MdxRenderResult* rendered,
+    std::ostream& out
+)
+{
+    DOCGEN_TRACE_SCOPE("writeJsonOutput", "");
+
+    if (layouts && !layouts->asciiCollation)
+        layouts = nullptr;
+
+    // v2는 크기를 줄이려는 형식이라 들여쓰기도 하지 않는다.
+    bool compact = schemaVersion == 2;
+    JsonWriter writer(out, compact);
+    writer.beginObject();
+    writer.key("schemaVersion");
+    writer.valueNumber(compact ? 2 : 1);
+    writer.key("generatorVersion");
+    writer.valueString(generatorVersion);
+    writer.key("luauVersion");
+    writer.valueNull();
+    if (compact)
+    {
+        JsonStringTable table;
+        for (const Module& module : modules)
+        {
+            table.add(module.id);
+            table.add(module.path);
+            for (const Symbol& symbol : module.symbols)
+                collectSymbolStrings(table, symbol);
+        }
+        table.finalize();
+
+        writer.key("strings");
+        table.write(writer);
+        writer.key("modules");
+        writer.beginArray();
+        for (const Module& module : modules)
+            writeModuleCompact(writer, table, module);
+        writer.endArray();
+    }
+    else
+    {
+        writer.key("modules");
+        writer.beginArray();
+        for (const Module& module : modules)
+            writeModule(writer, module);
+        writer.endArray();
+    }
+    writer.key("classes");
+    writeClassIndex(writer, index, layouts);
+    if (layouts)
+        writeClassOrder(writer, *layouts);
+    if (rendered && rendered->failedPaths.empty() && rendered->asciiCollation)
+    {
+        // generate.js는 outDir과 옵션 해시가 같을 때만 이 실행이 쓴 MDX를 그대로 쓰고 자체 렌더링을 건너뛴다.
+        writer.key("mdx");
+        writer.beginObject();
+        writer.key("outDir");
+        writer.valueString(normalizePath(rendered->outDir));
+        writer.key("pages");
+        writer.valueNumber(static_cast<long long>(rendered->pages));
+        writer.key("optionsHash");
+        writer.valueString(rendered->optionsHash);
+        writer.endObject();
+    }
+    writer.endObject();
+    out << "\n";
+}
+
+// 소스에서 '@inheritDoc <이름>'의 이름 후보를 모은다. parseDocBlock이 읽는 값을 모두 포함하도록 넉넉하게 잡는다.
+static void collectInheritDocTargets(const Source& source, std::unordered_set<std::string>& targets)
+{
+    static const std::string_view kTag = "@inheritDoc";
+    std::string_view content = source.content;
+
+    size_t pos = content.find(kTag);
+    while (pos != std::string_view::npos)
+    {
+        size_t valueStart = pos + kTag.size();
+        size_t lineEnd = content.find('\n', valueStart);
+        if (lineEnd == std::string_view::npos)
+            lineEnd = content.size();
+
+        if (valueStart < lineEnd && (content[valueStart] == ' ' || content[valueStart] == '\t'))
+        {
+            std::string value = trim(std::string(content.substr(valueStart, lineEnd - valueStart)));
+            size_t close = value.find("]=]");
+            if (close != std::string::npos)
+                targets.insert(trim(value.substr(0, close)));
+            if (!value.empty())
+                targets.insert(std::move(value));
+        }
+
+        pos = content.find(kTag, lineEnd);
+    }
+}
+
+// 어느 모듈에도 선언되지 않은 후보를 뺀다. qualifiedName은 분석 없이 정해지므로 구문 기반 심볼로 충분하다.
+// 없는 대상을 가리키는 모듈을 끝까지 붙잡아 두지 않기 위해서다.
+static void keepDeclaredInheritDocTargets(const std::vector<ModuleContext>& contexts, std::unordered_set<std::string>& targets)
+{
+    if (targets.empty())
+        return;
+
+    std::unordered_set<std::string> declared;
+    for (const ModuleContext& context : contexts)
+    {
+        std::vector<Diagnostic> scratch;
+        for (const Symbol& symbol : buildSymbols(context, nullptr, scratch))
+        {
+            if (targets.find(symbol.qualifiedName) != targets.end())
+                declared.insert(symbol.qualifiedName);
+        }
+    }
+    targets = std::move(declared);
+}
+
+// 모듈을 순서대로 받아 완성되는 대로 reference.json에 쓰고 버린다. writeJsonOutput(schemaVersion 1)과 결과가 같다.
+// 끝에 쓰는 classes 인덱스에는 참조와 이름만 남기고, @inheritDoc 대상 후보 심볼만 사본을 둔다.
+// classLayout이면 클래스와 멤버 후보의 LayoutSymbol도 남겨 끝에 레이아웃을 계산한다.
+// @inheritDoc 대상이 아직 나오지 않은 모듈은 순서를 지키기 위해 뒤 모듈과 함께 대상이 나올 때까지 붙잡아 둔다.
+// inheritTargets에는 실제로 선언된 대상만 있으므로, 없는 대상을 가리키는 모듈은 기다리지 않는다.
+class StreamingJsonOutput
+{
+public:
+    StreamingJsonOutput(
+        std::ostream& out,
+        const std::string& generatorVersion,
+        std::unordered_set<std::string> inheritTargets,
+        bool classLayout
+    )
+        : writer(out)
+        , out(out)
+        , inheritTargets(std::move(inheritTargets))
+        , classLayout(classLayout)
+    {
+        writer.beginObject();
+        writer.key("schemaVersion");
+        writer.valueNumber(1);
+        writer.key("generatorVersion");
+        writer.valueString(generatorVersion);
+        writer.key("luauVersion");
+        writer.valueNull();
+        writer.key("modules");
+        writer.beginArray();
+    }
+
+    void push(Module module)
+    {
+        size_t moduleIndex = heldStart + held.size();
+        for (size_t symbolIndex = 0; symbolIndex < module.symbols.size(); ++symbolIndex)
+            recordSymbol(module.symbols[symbolIndex], {moduleIndex, symbolIndex});
+
+        held.push_back(std::move(module));
+        peakHeld = std::max(peakHeld, held.size());
+        drain();
+    }
+
+    void finish()
+    {
+        DOCGEN_TRACE_SCOPE("writeJsonOutput", "");
+
+        finished = true;
+        drain();
+        writer.endArray();
+
+        for (ClassEntry& entry : index.classes)
+        {
+            for (ClassExtends& extends : entry.extends)
+                extends.classIndex = index.findClass(extends.name);
+        }
+
+        for (const auto& [within, ref] : memberCandidates)
+        {
+            if (std::optional<size_t> classIndex = index.findClass(within))
+                index.classes[*classIndex].members.push_back(ref);
+        }
+
+        std::optional<ClassLayoutSet> layouts;
+        if (classLayout)
+        {
+            layouts = buildClassLayouts(index, [&](const SymbolRef& ref) {
+                return layoutSymbols.at({ref.module, ref.symbol});
+            });
+            if (!layouts->asciiCollation)
+                layouts.reset();
+        }
+
+        writer.key("classes");
+        writeClassIndex(writer, index, layouts ? &*layouts : nullptr);
+        if (layouts)
+            writeClassOrder(writer, *layouts);
+        writer.endObject();
+        out << "\n";
+    }
+
+    size_t peakHeldModules() const
+    {
+        return peakHeld;
+    }
+
+private:
+    // buildSymbolIndex와 같은 규칙: 같은 이름의 클래스는 처음 나온 것만, @extends는 @inheritDoc 적용 전 태그에서 읽는다.
+    void recordSymbol(const Symbol& symbol, SymbolRef ref)
+    {
+        if (inheritTargets.find(symbol.qualifiedName) != inheritTargets.end())
+            firstRefs.emplace(symbol.qualifiedName, ref);
+
+        if (symbol.kind == "class")
+        {
+            if (symbol.name.empty() || !index.classesByName.emplace(symbol.name, index.classes.size()).second)
+                return;
+
+            ClassEntry entry{symbol.name, ref, {}, {}};
+            for (const TagValue& tag : symbol.tags)
+            {
+                if (tag.name == "extends" && !tag.value.empty())
+                    entry.extends.push_back({tag.value, std::nullopt});
+            }
+            index.classes.push_back(std::move(entry));
+            return;
+        }
+
+        std::string within = extractWithinName(symbol.qualifiedName);
+        if (!within.empty())
+            memberCandidates.emplace_back(std::move(within), ref);
+    }
+
+    // SymbolIndex::findQualified와 같은 규칙: 같은 모듈의 마지막 심볼, 없으면 전체에서 처음 나온 심볼
+    const Symbol* findTarget(const std::string& name, size_t moduleIndex, const Module& module) const
+    {
+        for (auto it = module.symbols.rbegin(); it != module.symbols.rend(); ++it)
+        {
+            if (it->qualifiedName == name)
+                return &*it;
+        }
+
+        auto refIt = firstRefs.find(name);
+        if (refIt == firstRefs.end())
+            return nullptr;
+
+        const SymbolRef& ref = refIt->second;
+        if (ref.module < moduleIndex)
+            return &donors.at(name);
+        return &held[ref.module - heldStart].symbols[ref.symbol];
+    }
+
+    bool isReady(const Module& module) const
+    {
+        if (finished)
+            return true;
+
+        for (const Symbol& symbol : module.symbols)
+        {
+            const std::string* targetName = findInheritDocTarget(symbol);
+            if (targetName && inheritTargets.find(*targetName) != inheritTargets.end()
+                && firstRefs.find(*targetName) == firstRefs.end())
+                return false;
+        }
+        return true;
+    }
+
+    void drain()
+    {
+        while (!held.empty() && isReady(held.front()))
+        {
+            Module& module = held.front();
+            for (Symbol& symbol : module.symbols)
+            {
+                const std::string* targetName = findInheritDocTarget(symbol);
+                if (!targetName)
+                    continue;
+
+                const Symbol* target = findTarget(*targetName, heldStart, module);
+                if (target && target != &symbol)
+                    inheritDocFrom(symbol, *target);
+            }
+
+            writeModule(writer, module);
+
+            for (size_t symbolIndex = 0; symbolIndex < module.symbols.size(); ++symbolIndex)
+            {
+                const Symbol& symbol = module.symbols[symbolIndex];
+                if (classLayout && (symbol.kind == "class" || !extractWithinName(symbol.qualifiedName).empty()))
+                    layoutSymbols.emplace(std::make_pair(heldStart, symbolIndex), makeLayoutSymbol(symbol));
+
+                auto refIt = firstRefs.find(symbol.qualifiedName);
+                if (refIt != firstRefs.end() && refIt->second.module == heldStart && refIt->second.symbol == symbolIndex)
+                    donors.emplace(symbol.qualifiedName, symbol);
+            }
+
+            held.pop_front();
+            heldStart++;
+        }
+    }
+
+    JsonWriter writer;
+    std::ostream& out;
+    std::unordered_set<std::string> inheritTargets;
+    std::unordered_map<std::string, SymbolRef> firstRefs;
+    std::unordered_map<std::string, Symbol> donors;
+    std::deque<Module> held;
+    size_t heldStart = 0;
+    size_t peakHeld = 0;
+    bool finished = false;
+    SymbolIndex index;
+    std::vector<std::pair<std::string, SymbolRef>> memberCandidates;
+    bool classLayout = false;
+    std::map<std::pair<size_t, size_t>, LayoutSymbol> layoutSymbols;
+};
+
+// 검색 인덱스는 사이트가 필요할 때 내려받으므로 들여쓰기 없이 쓴다.
+// documents: [page, anchor, kind, title, summary], postings: term마다 [document, fields, ...]
+static void writeSearchIndex(
+    const std::vector<Module>& modules,
+    const SymbolIndex& index,
+    const ClassLayoutSet& layouts,
+    const SearchIndex& search,
+    std::ostream& out
+)
+{
+    JsonWriter writer(out, true);
+    writer.beginObject();
+    writer.key("version");
+    writer.valueNumber(1);
+    writer.key("fields");
+    writer.beginArray();
+    for (const char* field : kSearchFieldNames)
+        writer.valueString(field);
+    writer.endArray();
+    writer.key("pages");
+    writer.beginArray();
+    for (size_t classIndex : search.pages)
+    {
+        writer.beginObject();
+        writer.key("link");
+        writer.valueString(layouts.classes[classIndex].link);
+        writer.key("title");
+        writer.valueString(index.classes[classIndex].name);
+        writer.endObject();
+    }
+    writer.endArray();
+    writer.key("documents");
+    writer.beginArray();
+    for (const SearchDocument& document : search.documents)
+    {
+        const Symbol& symbol = modules[document.ref.module].symbols[document.ref.symbol];
+        writer.beginArray();
+        writer.valueNumber(static_cast<long long>(document.page));
+        if (document.anchor)
+            writer.valueString(*document.anchor);
+        else
             writer.valueNull();
+        writer.valueString(symbol.kind);
+        writer.valueString(symbol.qualifiedName.empty() ? symbol.name : symbol.qualifiedName);
+        writer.valueString(symbol.summary);
+        writer.endArray();
+    }
+    writer.endArray();
+    writer.key("terms");
+    writer.beginArray();
+    for (const SearchTerm& term : search.terms)
+        writer.valueString(term.term);
+    writer.endArray();
+    writer.key("postings");
+    writer.beginArray();
+    for (const SearchTerm& term : search.terms)
+    {
+        writer.beginArray();
+        for (const SearchPosting& posting : term.postings)
+        {
+            writer.valueNumber(static_cast<long long>(posting.document));
+            writer.valueNumber(static_cast<int>(posting.fields));
+        }
+        writer.endArray();
+    }
+    writer.endArray();
+    writer.endObject();
+    out << "\n";
+}
+
+// generate.js의 MDX 렌더링을 그대로 옮긴 네이티브 렌더러.
+// 사이트가 renderer: "native"를 고르면 generate.js는 렌더링을 건너뛰고 manifest 정리만 한다.
+// 출력은 generate.js와 바이트 단위로 같아야 하므로 JS 쪽 규칙(trim 공백 집합, 정규식 동작)을 그대로 따른다.
+struct SourceLinkOptions
+{
+    std::string repoUrl;
+    std::string branch;
+    std::string basePath;
+    std::string stripPrefix;
+    std::string icon;
+};
+
+struct RenderOptions
+{
+    std::string routeBasePath;
+    std::string lang = "luau";
+    std::string overviewTitle = "Overview";
+    std::string defaultCategory = "Classes";
+    std::vector<std::string> categoryOrder;
+    std::optional<SourceLinkOptions> source;
+    // --render-options 원문의 sha1. generate.js는 자기 옵션과 같을 때만 이 페이지를 그대로 쓴다.
+    std::string hash;
+};
+
+static const char* const kDefaultSourceIcon =
+    "<svg viewBox=\"0 0 24 24\" aria-hidden=\"true\" focusable=\"false\" class=\"sb-ref-source-icon\"><path fill=\"currentColor\" "
+    "d=\"M8.7 16.6 4.1 12l4.6-4.6L7.3 6l-6 6 6 6 1.4-1.4zm6.6 0L19.9 12l-4.6-4.6L16.7 6l6 6-6 6-1.4-1.4zM10 19l4-14h2l-4 14z\"/></svg>";
+
+static std::string stripSlashes(std::string value, bool leading)
+{
+    size_t end = value.size();
+    while (end > 0 && value[end - 1] == '/')
+        end--;
+    size_t start = 0;
+    while (leading && start < end && value[start] == '/')
+        start++;
+    return value.substr(start, end - start);
+}
+
+// 렌더 옵션 JSON은 generate.js의 buildNativeRenderOptions가 만든다. 문자열이 아닌 값은 빈 값으로 본다.
+static std::optional<RenderOptions> parseRenderOptions(const std::string& text)
+{
+    std::optional<JsonValue> root = JsonReader(text).parse();
+    if (!root || root->kind != JsonValue::Kind::Object)
+        return std::nullopt;
+
+    auto readString = [](const JsonValue& object, const char* name) -> std::string {
+        const JsonValue* value = object.find(name);
+        return value && value->kind == JsonValue::Kind::String ? value->stringValue : std::string();
+    };
+
+    RenderOptions options;
+    if (std::string lang = readString(*root, "lang"); !lang.empty())
+        options.lang = lang;
+    if (std::string title = readString(*root, "overviewTitle"); !title.empty())
+        options.overviewTitle = title;
+    if (std::string category = readString(*root, "defaultCategory"); !category.empty())
+        options.defaultCategory = category;
+
+    const JsonValue* routeBasePath = root->find("routeBasePath");
+    if (routeBasePath && routeBasePath->kind == JsonValue::Kind::String)
+        options.routeBasePath = stripSlashes(routeBasePath->stringValue, true);
+    else
+        options.routeBasePath = "reference/" + options.lang;
+
+    if (const JsonValue* order = root->find("categoryOrder"); order && order->kind == JsonValue::Kind::Array)
+    {
+        for (const JsonValue& item : order->items)
+        {
+            if (item.kind == JsonValue::Kind::String)
+                options.categoryOrder.push_back(item.stringValue);
+        }
+    }
+
+    if (const JsonValue* source = root->find("source"); source && source->kind == JsonValue::Kind::Object)
+    {
+        SourceLinkOptions link;
+        link.repoUrl = readString(*source, "repoUrl");
+        link.branch = readString(*source, "branch");
+        link.basePath = readString(*source, "basePath");
+        link.stripPrefix = readString(*source, "stripPrefix");
+        link.icon = readString(*source, "icon");
+        if (!link.repoUrl.empty())
+            options.source = std::move(link);
+    }
+
+    return options;
+}
+
+// String.prototype.trim()이 지우는 공백(ASCII 공백, NBSP, U+2000대 공백, BOM 등)을 UTF-8 바이트로 판정한다.
+static size_t jsWhitespaceAt(std::string_view text, size_t pos)
+{
+    unsigned char c = static_cast<unsigned char>(text[pos]);
+    if (c == ' ' || (c >= '\t' && c <= '\r'))
+        return 1;
+
+    auto byteAt = [&](size_t offset) -> unsigned char {
+        return pos + offset < text.size() ? static_cast<unsigned char>(text[pos + offset]) : 0;
+    };
+
+    if (c == 0xC2 && byteAt(1) == 0xA0)
+        return 2;
+    if (c == 0xE1 && byteAt(1) == 0x9A && byteAt(2) == 0x80)
+        return 3;
+    if (c == 0xE2 && byteAt(1) == 0x80 && ((byteAt(2) >= 0x80 && byteAt(2) <= 0x8A) || byteAt(2) == 0xA8 || byteAt(2) == 0xA9 || byteAt(2) == 0xAF))
+        return 3;
+    if (c == 0xE2 && byteAt(1) == 0x81 && byteAt(2) == 0x9F)
+        return 3;
+    if (c == 0xE3 && byteAt(1) == 0x80 && byteAt(2) == 0x80)
+        return 3;
+    if (c == 0xEF && byteAt(1) == 0xBB && byteAt(2) == 0xBF)
+        return 3;
+    return 0;
+}
+
+static std::string_view jsTrim(std::string_view text)
+{
+    size_t start = 0;
+    while (start < text.size())
+    {
+        size_t length = jsWhitespaceAt(text, start);
+        if (length == 0)
+            break;
+        start += length;
+    }
+
+    size_t end = text.size();
+    while (end > start)
+    {
+        // 끝에서부터는 1~3바이트 후보를 모두 확인한다.
+        size_t length = 0;
+        for (size_t width = 1; width <= 3 && width <= end - start; ++width)
+        {
+            if (jsWhitespaceAt(text.substr(0, end), end - width) == width)
+            {
+                length = width;
+                break;
+            }
+        }
+        if (length == 0)
+            break;
+        end -= length;
+    }
+
+    return text.substr(start, end - start);
+}
+
+static bool isJsBlank(std::string_view text)
+{
+    return jsTrim(text).empty();
+}
+
+// 정규식의 `.`이 넘지 못하는 줄 끝 문자(\n, \r, U+2028, U+2029)
+static bool hasJsLineTerminator(std::string_view text)
+{
+    for (size_t i = 0; i < text.size(); ++i)
+    {
+        if (text[i] == '\n' || text[i] == '\r')
+            return true;
+        if (static_cast<unsigned char>(text[i]) == 0xE2 && i + 2 < text.size() && static_cast<unsigned char>(text[i + 1]) == 0x80
+            && (static_cast<unsigned char>(text[i + 2]) == 0xA8 || static_cast<unsigned char>(text[i + 2]) == 0xA9))
+            return true;
+    }
+    return false;
+}
+
+static bool isWordByte(char c)
+{
+    return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+// lines.join("\n")과 같은 결과를 한 버퍼에 바로 쌓는다.
+struct MdxLines
+{
+    std::string text;
+    bool empty = true;
+
+    void push(std::string_view line)
+    {
+        if (!empty)
+            text.push_back('\n');
+        text.append(line.data(), line.size());
+        empty = false;
+    }
+};
+
+static std::string fenceLanguage(const RenderOptions& options)
+{
+    return options.lang == "luau" ? "lua" : options.lang;
+}
+
+static std::string applyDefaultFenceLanguage(const std::string& markdown, const std::string& language)
+{
+    if (markdown.empty())
+        return markdown;
+
+    MdxLines output;
+    output.text.reserve(markdown.size() + 16);
+    bool inFence = false;
+    size_t start = 0;
+    while (true)
+    {
+        size_t newline = markdown.find('\n', start);
+        size_t end = newline == std::string::npos ? markdown.size() : newline;
+        if (newline != std::string::npos && end > start && markdown[end - 1] == '\r')
+            end--;
+
+        std::string_view line(markdown.data() + start, end - start);
+        std::string_view trimmed = jsTrim(line);
+        if (trimmed.substr(0, 3) == "```")
+        {
+            std::string_view fenceLang = jsTrim(trimmed.substr(3));
+            if (!inFence)
+            {
+                if (fenceLang.empty())
+                    output.push("```" + (language == "luau" ? std::string("lua") : language));
+                else if (fenceLang == "luau")
+                    output.push("```lua");
+                else
+                    output.push(line);
+                inFence = true;
+            }
+            else
+            {
+                output.push(line);
+                inFence = false;
+            }
+        }
+        else
+        {
+            output.push(line);
+        }
+
+        if (newline == std::string::npos)
+            break;
+        start = newline + 1;
+    }
+
+    return output.text;
+}
+
+using ClassLinkMap = std::unordered_map<std::string, std::string>;
+
+static std::string_view stripApiPrefix(std::string_view value)
+{
+    for (std::string_view prefix : {"Class.", "Datatype.", "Enum.", "Global.", "Library."})
+    {
+        if (value.substr(0, prefix.size()) == prefix)
+            return value.substr(prefix.size());
+    }
+    return value;
+}
+
+static std::optional<std::string> resolveApiTargetLink(std::string_view target, const RenderOptions& options, const ClassLinkMap* classLinks)
+{
+    if (target.substr(0, 6) != "Class.")
+        return std::nullopt;
+
+    std::string_view rest = target.substr(6);
+    if (rest.empty())
+        return std::nullopt;
+
+    std::string basePath = options.routeBasePath.empty() ? "" : "/" + options.routeBasePath;
+
+    // /^([A-Za-z0-9_]+)([:\.])(.+)$/
+    std::string_view className = rest;
+    std::optional<std::string_view> memberName;
+    size_t wordEnd = 0;
+    while (wordEnd < rest.size() && isWordByte(rest[wordEnd]))
+        wordEnd++;
+    if (wordEnd > 0 && wordEnd + 1 < rest.size() && (rest[wordEnd] == ':' || rest[wordEnd] == '.')
+        && !hasJsLineTerminator(rest.substr(wordEnd + 1)))
+    {
+        className = rest.substr(0, wordEnd);
+        memberName = rest.substr(wordEnd + 1);
+    }
+
+    std::string link = basePath + "/classes/" + sanitizeModulePath(std::string(className));
+    if (classLinks)
+    {
+        auto it = classLinks->find(std::string(className));
+        if (it != classLinks->end())
+            link = basePath + "/" + it->second;
+    }
+
+    if (memberName)
+    {
+        // .replace(/\(.*\)$/, ""): 멤버 이름에는 줄 끝 문자가 없으므로 첫 '('부터 끝까지가 `)`로 끝나면 지운다.
+        std::string_view cleaned = *memberName;
+        size_t paren = cleaned.find('(');
+        if (!cleaned.empty() && cleaned.back() == ')' && paren != std::string_view::npos)
+            cleaned = cleaned.substr(0, paren);
+
+        if (std::optional<std::string> anchor = sanitizeAnchorId(std::string(cleaned)))
+            link += "#" + *anchor;
+    }
+
+    return link;
+}
+
+// `Class.Foo:bar|label` 형태의 인라인 코드를 API 링크로 바꾼다. /`([^`\n]+)`/g와 같은 범위를 찾는다.
+static std::string applyApiLinks(const std::string& markdown, const RenderOptions& options, const ClassLinkMap* classLinks)
+{
+    if (markdown.empty())
+        return markdown;
+
+    std::string out;
+    out.reserve(markdown.size());
+    size_t i = 0;
+    while (i < markdown.size())
+    {
+        if (markdown[i] != '`')
+        {
+            out.push_back(markdown[i++]);
+            continue;
+        }
+
+        size_t close = i + 1;
+        while (close < markdown.size() && markdown[close] != '`' && markdown[close] != '\n')
+            close++;
+        if (close >= markdown.size() || markdown[close] != '`' || close == i + 1)
+        {
+            out.push_back(markdown[i++]);
+            continue;
+        }
+
+        std::string_view content(markdown.data() + i + 1, close - i - 1);
+        i = close + 1;
+
+        size_t bar = content.find('|');
+        std::string_view target = jsTrim(content.substr(0, bar));
+        std::optional<std::string_view> label;
+        if (bar != std::string_view::npos)
+            label = jsTrim(content.substr(bar + 1));
+
+        if (label && *label == "no-link")
+        {
+            out += "`";
+            out += target;
+            out += "`";
+            continue;
+        }
+
+        std::optional<std::string> link = resolveApiTargetLink(target, options, classLinks);
+        std::string_view display = label && !label->empty() ? *label : stripApiPrefix(target);
+        if (!link)
+        {
+            out += "`";
+            out += display.empty() ? target : display;
+            out += "`";
+            continue;
+        }
+
+        out += "[";
+        out += display;
+        out += "](";
+        out += *link;
+        out += ")";
+    }
+
+    return out;
+}
+
+// /\]\(\/api\/([A-Za-z0-9_]+)(#[^)]+)?\)/g 를 routeBasePath 아래 링크로 바꾼다.
+static std::string rewriteLegacyApiLinks(const std::string& markdown, const RenderOptions& options)
+{
+    if (markdown.empty())
+        return markdown;
+
+    static const std::string_view kLegacyPrefix = "](/api/";
+    std::string basePath = "/" + options.routeBasePath;
+
+    std::string out;
+    out.reserve(markdown.size());
+    size_t pos = 0;
+    while (true)
+    {
+        size_t found = markdown.find(kLegacyPrefix, pos);
+        if (found == std::string::npos)
+            break;
+
+        size_t nameStart = found + kLegacyPrefix.size();
+        size_t nameEnd = nameStart;
+        while (nameEnd < markdown.size() && isWordByte(markdown[nameEnd]))
+            nameEnd++;
+
+        size_t close = nameEnd;
+        if (nameEnd < markdown.size() && markdown[nameEnd] == '#')
+        {
+            size_t hashClose = markdown.find(')', nameEnd + 1);
+            if (hashClose != std::string::npos && hashClose > nameEnd + 1)
+                close = hashClose;
+        }
+
+        if (nameEnd == nameStart || close >= markdown.size() || markdown[close] != ')')
+        {
+            out.append(markdown, pos, found + 1 - pos);
+            pos = found + 1;
+            continue;
+        }
+
+        out.append(markdown, pos, found - pos);
+        out += "](";
+        out += basePath;
+        out += "/";
+        out.append(markdown, nameStart, close - nameStart);
+        out += ")";
+        pos = close + 1;
+    }
+
+    out.append(markdown, pos, std::string::npos);
+    return out;
+}
+
+static std::optional<std::string> resolveSourceUrl(const Symbol& symbol, const RenderOptions& options)
+{
+    if (symbol.file.empty() || !options.source)
+        return std::nullopt;
+
+    const SourceLinkOptions& source = *options.source;
+    std::string url = stripSlashes(source.repoUrl, false) + "/blob/" + (source.branch.empty() ? "main" : source.branch);
+
+    std::string basePath = stripSlashes(source.basePath, false);
+    if (!basePath.empty())
+        url += "/" + basePath;
+
+    std::string relative = symbol.file;
+    std::replace(relative.begin(), relative.end(), '\\', '/');
+    if (!source.stripPrefix.empty() && relative.compare(0, source.stripPrefix.size(), source.stripPrefix) == 0)
+    {
+        relative.erase(0, source.stripPrefix.size());
+        if (!relative.empty() && relative.front() == '/')
+            relative.erase(0, 1);
+    }
+
+    url += "/" + relative;
+    if (symbol.line != 0)
+        url += "#L" + std::to_string(symbol.line);
+    return url;
+}
+
+static std::string sourceActionsLine(const std::string& url, const RenderOptions& options)
+{
+    const std::string& icon = options.source && !options.source->icon.empty() ? options.source->icon : std::string(kDefaultSourceIcon);
+    return "<div class=\"sb-ref-heading-actions\"><a class=\"sb-ref-source sb-ref-source-inline\" href=\"" + url + "\">" + icon
+        + "</a></div>";
+}
+
+static std::string tagDisplayValue(const TagValue& tag)
+{
+    if (tag.hasBool)
+        return tag.boolValue ? "true" : "false";
+    return tag.value;
+}
+
+// renderSymbol/renderSymbolBody 공통 부분: 타입 표시, 설명(없으면 요약), 태그 목록
+static void appendSymbolBody(MdxLines& lines, const Symbol& symbol, const RenderOptions& options, const ClassLinkMap* classLinks)
+{
+    if (!symbol.types.display.empty())
+    {
+        lines.push("");
+        lines.push("```" + fenceLanguage(options));
+        lines.push(symbol.types.display);
+        lines.push("```");
+    }
+
+    std::string description = rewriteLegacyApiLinks(
+        applyApiLinks(applyDefaultFenceLanguage(symbol.descriptionMarkdown, options.lang), options, classLinks), options
+    );
+    if (!isJsBlank(description))
+    {
+        lines.push("");
+        lines.push(description);
+    }
+    else if (!isJsBlank(symbol.summary))
+    {
+        lines.push("");
+        lines.push(symbol.summary);
+    }
+
+    if (!symbol.tags.empty())
+    {
+        lines.push("");
+        lines.push("Tags:");
+        for (const TagValue& tag : symbol.tags)
+            lines.push("- " + tag.name + ": " + tagDisplayValue(tag));
+    }
+}
+
+static const std::string& symbolHeadingLabel(const Symbol& symbol)
+{
+    static const std::string unnamed = "Unnamed";
+    if (!symbol.name.empty())
+        return symbol.name;
+    if (!symbol.qualifiedName.empty())
+        return symbol.qualifiedName;
+    return unnamed;
+}
+
+static std::string renderMemberSymbol(
+    const Symbol& symbol,
+    const std::optional<std::string>& anchor,
+    const RenderOptions& options,
+    const ClassLinkMap& classLinks
+)
+{
+    MdxLines lines;
+    const std::string& headingLabel = symbolHeadingLabel(symbol);
+    lines.push(anchor ? "### " + headingLabel + " {#" + *anchor + "}" : "### " + headingLabel);
+
+    if (std::optional<std::string> sourceUrl = resolveSourceUrl(symbol, options))
+    {
+        lines.push("");
+        lines.push(sourceActionsLine(*sourceUrl, options));
+    }
+
+    appendSymbolBody(lines, symbol, options, &classLinks);
+    return lines.text;
+}
+
+static std::string renderClassPage(
+    const std::vector<Module>& modules,
+    const ClassEntry& entry,
+    const ClassLayout& layout,
+    const RenderOptions& options,
+    const ClassLinkMap& classLinks
+)
+{
+    const Symbol& classSymbol = modules[entry.classSymbol.module].symbols[entry.classSymbol.symbol];
+    auto memberSymbol = [&](const LayoutMember& member) -> const Symbol& {
+        return modules[member.ref.module].symbols[member.ref.symbol];
+    };
+
+    MdxLines lines;
+    lines.push("# " + (classSymbol.name.empty() ? std::string("Class") : classSymbol.name));
+
+    if (std::optional<std::string> sourceUrl = resolveSourceUrl(classSymbol, options))
+    {
+        lines.push("");
+        lines.push(sourceActionsLine(*sourceUrl, options));
+    }
+
+    // 클래스 본문의 API 링크는 generate.js와 마찬가지로 classLinkMap 없이 해석한다.
+    MdxLines body;
+    appendSymbolBody(body, classSymbol, options, nullptr);
+    if (!isJsBlank(body.text))
+    {
+        lines.push("");
+        lines.push(body.text);
+    }
+
+    lines.push("");
+    lines.push("## Summary");
+
+    std::vector<const TagValue*> extends;
+    for (const TagValue& tag : classSymbol.tags)
+    {
+        if (tag.name == "extends" && (tag.hasBool ? tag.boolValue : !tag.value.empty()))
+            extends.push_back(&tag);
+    }
+    if (!extends.empty())
+    {
+        lines.push("");
+        lines.push("### Extends");
+        for (const TagValue* tag : extends)
+        {
+            // Map.get(true)는 문자열 키와 맞지 않으므로 불리언 값은 링크하지 않는다.
+            auto it = tag->hasBool ? classLinks.end() : classLinks.find(tag->value);
+            std::string value = tagDisplayValue(*tag);
+            lines.push(it != classLinks.end() ? "- [" + value + "](" + it->second + ")" : "- " + value);
+        }
+    }
+
+    for (const LayoutSection& section : layout.sections)
+    {
+        lines.push("");
+        lines.push("### " + section.label);
+        for (const LayoutMember& member : section.members)
+        {
+            const std::string& label = symbolHeadingLabel(memberSymbol(member));
+            lines.push(member.anchor ? "- [" + label + "](#" + *member.anchor + ")" : "- " + label);
+        }
+    }
+
+    for (const LayoutSection& section : layout.sections)
+    {
+        lines.push("");
+        lines.push("## " + section.label + " {#" + section.anchor + "}");
+        for (const LayoutMember& member : section.members)
+        {
+            lines.push("");
+            lines.push(renderMemberSymbol(memberSymbol(member), member.anchor, options, classLinks));
+        }
+    }
+
+    lines.text.push_back('\n');
+    return lines.text;
+}
+
+// 삽입 순서를 유지하는 문자열 키 목록. JS Map 순회 순서를 흉내 낸다.
+template<typename T>
+struct OrderedGroups
+{
+    std::vector<std::pair<std::string, T>> entries;
+    std::unordered_map<std::string, size_t> positions;
+
+    T& at(const std::string& key)
+    {
+        auto [it, inserted] = positions.emplace(key, entries.size());
+        if (inserted)
+            entries.push_back({key, T{}});
+        return entries[it->second].second;
+    }
+};
+
+static std::string renderOverviewPage(const SymbolIndex& index, const ClassLayoutSet& layouts, const RenderOptions& options)
+{
+    MdxLines lines;
+    lines.push("---");
+    lines.push("title: " + options.overviewTitle);
+    lines.push("sidebar_label: Overview");
+    lines.push("sidebar_position: 1");
+    lines.push("---");
+    lines.push("");
+    lines.push("# " + options.overviewTitle);
+    lines.push("");
+    lines.push("<div className=\"sb-ref-overview\">");
+
+    OrderedGroups<std::vector<size_t>> categories;
+    for (size_t classIndex : layouts.order)
+    {
+        const std::vector<std::string>& classCategories = layouts.classes[classIndex].categories;
+        if (classCategories.empty())
+        {
+            categories.at(options.defaultCategory).push_back(classIndex);
+            continue;
+        }
+        for (const std::string& category : classCategories)
+            categories.at(isJsBlank(category) ? options.defaultCategory : category).push_back(classIndex);
+    }
+
+    if (categories.entries.empty())
+    {
+        lines.push("<p>No classes found.</p>");
+        lines.push("</div>");
+        lines.text.push_back('\n');
+        return lines.text;
+    }
+
+    OrderedGroups<OrderedGroups<std::vector<size_t>>> groups;
+    for (const auto& [category, items] : categories.entries)
+    {
+        std::vector<std::string> parts;
+        size_t start = 0;
+        while (true)
+        {
+            size_t slash = category.find('/', start);
+            std::string_view part = jsTrim(std::string_view(category).substr(start, slash == std::string::npos ? std::string::npos : slash - start));
+            if (!part.empty())
+                parts.emplace_back(part);
+            if (slash == std::string::npos)
+                break;
+            start = slash + 1;
+        }
+
+        std::string top = parts.empty() ? category : parts.front();
+        std::string rest;
+        for (size_t i = 1; i < parts.size(); ++i)
+            rest += (i > 1 ? "/" : "") + parts[i];
+
+        std::vector<size_t>& list = groups.at(top).at(rest);
+        list.insert(list.end(), items.begin(), items.end());
+    }
+
+    auto orderIndex = [&](const std::string& name) -> long {
+        auto it = std::find(options.categoryOrder.begin(), options.categoryOrder.end(), name);
+        return it == options.categoryOrder.end() ? -1 : static_cast<long>(it - options.categoryOrder.begin());
+    };
+
+    auto& topEntries = groups.entries;
+    std::stable_sort(topEntries.begin(), topEntries.end(), [&](const auto& left, const auto& right) {
+        long leftIndex = orderIndex(left.first);
+        long rightIndex = orderIndex(right.first);
+        if (leftIndex != -1 || rightIndex != -1)
+        {
+            if (leftIndex == -1)
+                return false;
+            if (rightIndex == -1)
+                return true;
+            return leftIndex < rightIndex;
+        }
+        return localeCompare(left.first, right.first) < 0;
+    });
+
+    for (auto& [top, subGroups] : topEntries)
+    {
+        size_t flatCount = 0;
+        for (const auto& sub : subGroups.entries)
+            flatCount += sub.second.size();
+
+        lines.push("");
+        lines.push("<section className=\"sb-ref-section\">");
+        lines.push("<div className=\"sb-ref-section-title\">" + top + "</div>");
+        lines.push("<div className=\"sb-ref-section-meta\">" + std::to_string(flatCount) + " classes</div>");
+
+        auto& subEntries = subGroups.entries;
+        std::stable_sort(subEntries.begin(), subEntries.end(), [](const auto& left, const auto& right) {
+            return localeCompare(left.first, right.first) < 0;
+        });
+
+        for (auto& [sub, items] : subEntries)
+        {
+            std::stable_sort(items.begin(), items.end(), [&](size_t left, size_t right) {
+                return localeCompare(index.classes[left].name, index.classes[right].name) < 0;
+            });
+
+            if (!sub.empty())
+            {
+                lines.push("");
+                lines.push("<div className=\"sb-ref-subtitle\">" + sub + "</div>");
+            }
+            lines.push("<div className=\"sb-ref-card-grid\">");
+            for (size_t classIndex : items)
+            {
+                lines.push("<a className=\"sb-ref-card\" href=\"" + layouts.classes[classIndex].link + "\">");
+                lines.push("<div className=\"sb-ref-card-title\">" + index.classes[classIndex].name + "</div>");
+                lines.push("</a>");
+            }
+            lines.push("</div>");
+        }
+
+        lines.push("</section>");
+    }
+
+    lines.push("</div>");
+    lines.text.push_back('\n');
+    return lines.text;
+}
+
+static bool writeTextFile(const fs::path& path, const std::string& content)
+{
+    std::ofstream file(path, std::ios::binary);
+    file.write(content.data(), static_cast<std::streamsize>(content.size()));
+    return static_cast<bool>(file);
+}
+
+// 클래스 페이지는 클래스별로 나눠 병렬로 렌더링하고 바로 쓴다. 출력 정리(manifest, stale 파일)는 generate.js가 맡는다.
+static MdxRenderResult renderMdxPages(
+    const std::vector<Module>& modules,
+    const SymbolIndex& index,
+    const ClassLayoutSet& layouts,
+    const RenderOptions& options,
+    const fs::path& outDir
+)
+{
+    DOCGEN_TRACE_SCOPE("renderMdx", "");
+
+    ClassLinkMap classLinks;
+    for (size_t classIndex : layouts.order)
+        classLinks[index.classes[classIndex].name] = layouts.classes[classIndex].link;
+
+    // 경로가 겹치면 generate.js처럼 나중 페이지가 이긴다. 앞선 것은 쓰지 않아 스레드 간 경합을 없앤다.
+    std::unordered_map<std::string, size_t> lastWriter;
+    for (size_t position = 0; position < layouts.order.size(); ++position)
+        lastWriter[layouts.classes[layouts.order[position]].path] = position;
+
+    std::vector<size_t> pages;
+    std::set<fs::path> directories = {outDir};
+    for (size_t position = 0; position < layouts.order.size(); ++position)
+    {
+        const ClassLayout& layout = layouts.classes[layouts.order[position]];
+        if (lastWriter[layout.path] != position)
+            continue;
+        pages.push_back(layouts.order[position]);
+        directories.insert((outDir / layout.path).parent_path());
+    }
+
+    for (const fs::path& directory : directories)
+        fs::create_directories(directory);
+
+    MdxRenderResult result;
+    result.outDir = outDir;
+    result.optionsHash = options.hash;
+    result.asciiCollation = layouts.asciiCollation && isAsciiText(options.defaultCategory);
+    std::vector<char> failed(pages.size(), 0);
+    runParallel(pages.size(), [&](size_t i) {
+        size_t classIndex = pages[i];
+        const ClassLayout& layout = layouts.classes[classIndex];
+        std::string content = renderClassPage(modules, index.classes[classIndex], layout, options, classLinks);
+        failed[i] = !writeTextFile(outDir / layout.path, content);
+    });
+
+    for (size_t i = 0; i < pages.size(); ++i)
+    {
+        if (failed[i])
+            result.failedPaths.push_back(layouts.classes[pages[i]].path);
+    }
+
+    if (!writeTextFile(outDir / "index.mdx", renderOverviewPage(index, layouts, options)))
+        result.failedPaths.push_back("index.mdx");
+
+    result.pages = pages.size() + 1;
+    return result;
+}
+
+// 항상 켜져 있는 가벼운 카운터. --stats를 주면 사이드카 JSON으로 남긴다.
+struct DocgenStats
+{
+    std::chrono::steady_clock::time_point origin = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point lastMark = origin;
+    std::vector<std::pair<std::string, double>> stageMs;
+
+    size_t filesScanned = 0;
+    size_t sourceBytes = 0;
+    size_t docBlocks = 0;
+    size_t bindings = 0;
+    size_t modules = 0;
+    size_t modulesTypeChecked = 0;
+    size_t symbols = 0;
+    std::map<std::string, size_t> symbolsByKind;
+    size_t diagnostics = 0;
+    size_t typeDisplayHits = 0;
+    size_t typeDisplayMisses = 0;
+    size_t requireCacheHits = 0;
+    size_t requireCacheMisses = 0;
+
+    void markStage(const char* name)
+    {
+        auto now = std::chrono::steady_clock::now();
+        stageMs.push_back({name, std::chrono::duration<double, std::milli>(now - lastMark).count()});
+        lastMark = now;
+    }
+
+    double totalMs() const
+    {
+        return std::chrono::duration<double, std::milli>(lastMark - origin).count();
+    }
+};
+
+static long long roundMicros(double ms)
+{
+    return static_cast<long long>(ms * 1000.0 + 0.5);
+}
+
+static void writeStatsOutput(const DocgenStats& stats, const std::string& generatorVersion, std::ostream& out)
+{
+    JsonWriter writer(out);
+    writer.beginObject();
+    writer.key("generatorVersion");
+    writer.valueString(generatorVersion);
+    writer.key("files");
+    writer.valueNumber(static_cast<long long>(stats.filesScanned));
+    writer.key("sourceBytes");
+    writer.valueNumber(static_cast<long long>(stats.sourceBytes));
+    writer.key("docBlocks");
+    writer.valueNumber(static_cast<long long>(stats.docBlocks));
+    writer.key("bindings");
+    writer.valueNumber(static_cast<long long>(stats.bindings));
+    writer.key("modules");
+    writer.valueNumber(static_cast<long long>(stats.modules));
+    writer.key("modulesTypeChecked");
+    writer.valueNumber(static_cast<long long>(stats.modulesTypeChecked));
+    writer.key("symbols");
+    writer.valueNumber(static_cast<long long>(stats.symbols));
+    writer.key("symbolsByKind");
+    writer.beginObject();
+    for (const auto& [kind, count] : stats.symbolsByKind)
+    {
+        writer.key(kind);
+        writer.valueNumber(static_cast<long long>(count));
+    }
+    writer.endObject();
+    writer.key("diagnostics");
+    writer.valueNumber(static_cast<long long>(stats.diagnostics));
+
+    // 생성 중 타입 표시는 모두 캐시를 거치므로 typeDisplay miss가 곧 Luau::toString 호출 수다.
+    writer.key("caches");
+    writer.beginObject();
+    writer.key("typeDisplay");
+    writer.beginObject();
+    writer.key("hits");
+    writer.valueNumber(static_cast<long long>(stats.typeDisplayHits));
+    writer.key("misses");
+    writer.valueNumber(static_cast<long long>(stats.typeDisplayMisses));
+    writer.endObject();
+    writer.key("require");
+    writer.beginObject();
+    writer.key("hits");
+    writer.valueNumber(static_cast<long long>(stats.requireCacheHits));
+    writer.key("misses");
+    writer.valueNumber(static_cast<long long>(stats.requireCacheMisses));
+    writer.endObject();
+    writer.endObject();
+
+    // 시간은 마이크로초 정수로 남겨 대시보드에서 부동소수 비교를 피한다.
+    writer.key("stagesUs");
+    writer.beginObject();
+    for (const auto& [name, ms] : stats.stageMs)
+    {
+        writer.key(name);
+        writer.valueNumber(roundMicros(ms));
+    }
+    writer.endObject();
+    writer.key("totalUs");
+    writer.valueNumber(roundMicros(stats.totalMs()));
+    writer.endObject();
+    out << "\n";
+}
+
+#ifdef LUAU_DOCGEN_TRACING
+static void writeTraceOutput(const std::vector<TraceEvent>& events, std::ostream& out)
+{
+    JsonWriter writer(out);
+    writer.beginObject();
+    writer.key("displayTimeUnit");
+    writer.valueString("ms");
+    writer.key("traceEvents");
+    writer.beginArray();
+    for (const TraceEvent& event : events)
+    {
+        writer.beginObject();
+        writer.key("name");
+        writer.valueString(event.name);
+        writer.key("cat");
+        writer.valueString("docgen");
+        writer.key("ph");
+        writer.valueString("X");
+        writer.key("ts");
+        writer.valueNumber(event.startUs);
+        writer.key("dur");
+        writer.valueNumber(event.durationUs);
+        writer.key("pid");
+        writer.valueNumber(1);
+        writer.key("tid");
+        writer.valueNumber(event.threadId);
+        if (!event.detail.empty())
+        {
+            writer.key("args");
+            writer.beginObject();
+            writer.key("detail");
+            writer.valueString(event.detail);
+            writer.endObject();
+        }
+        writer.endObject();
+    }
+    writer.endArray();
+    writer.endObject();
+    out << "\n";
+}
+
+static void finishTrace(const fs::path& tracePath)
+{
+    DocgenTracer& tracer = docgenTracer();
+    std::vector<TraceEvent> events;
+    {
+        std::lock_guard<std::mutex> lock(tracer.mutex);
+        tracer.enabled = false;
+        events.swap(tracer.events);
+    }
+
+    std::sort(events.begin(), events.end(), [](const TraceEvent& a, const TraceEvent& b) {
+        return a.startUs < b.startUs;
+    });
+
+    if (tracePath.has_parent_path())
+        fs::create_directories(tracePath.parent_path());
+    std::ofstream traceFile(tracePath, std::ios::binary);
+    writeTraceOutput(events, traceFile);
+}
+#endif
+
+static Module generateModule(
+    const ModuleContext& context,
+    const GeneratorOptions& options,
+    const std::unordered_map<std::string, std::string>& moduleOverrides,
+    std::vector<Symbol> symbols
+)
+{
+    (void)options;
+
+    std::string moduleId = context.moduleId;
+    auto overrideIt = moduleOverrides.find(context.rootRelativePath);
+    if (overrideIt != moduleOverrides.end())
+        moduleId = overrideIt->second;
+
+    Module module;
+    module.id = moduleId;
+    module.path = context.rootRelativePath;
+    module.sourceHash = context.source.rawHash;
+    module.symbols = std::move(symbols);
+    return module;
+}
+
+static void printDiagnostics(const std::vector<Diagnostic>& diagnostics)
+{
+    for (const Diagnostic& diagnostic : diagnostics)
+    {
+        std::string level = diagnostic.level;
+        std::transform(level.begin(), level.end(), level.begin(), [](unsigned char ch) {
+            return std::toupper(ch);
+        });
+        std::cerr << "[luau-docgen] " << level << " " << diagnostic.file << ":" << diagnostic.line << " "
+                  << diagnostic.message << "\n";
+    }
+}
+
+static Luau::FrontendOptions makeFrontendOptions(const GeneratorOptions& options)
+{
+    Luau::FrontendOptions frontendOptions;
+    frontendOptions.retainFullTypeGraphs = true;
+    frontendOptions.applyInternalLimitScaling = checkLimitScale(options).has_value();
+    return frontendOptions;
+}
+
+static std::optional<RenderOptions> resolveRenderOptions(const GeneratorOptions& options)
+{
+    std::string text = options.renderOptionsJson.empty() ? "{}" : options.renderOptionsJson;
+    std::optional<RenderOptions> renderOptions = parseRenderOptions(text);
+    if (renderOptions)
+        renderOptions->hash = sha1(text);
+    return renderOptions;
+}
+
+// 색인의 페이지 링크와 앵커는 generate.js가 쓰는 레이아웃에서 온다. 정렬 키가 ASCII가 아니면 레이아웃을 출력하지 않고
+// generate.js가 직접 계산하므로, 어긋날 수 있는 색인을 쓰지 않고 이전 실행의 색인도 지운다.
+static void writeSearchIndexFile(
+    const std::vector<Module>& modules,
+    const SymbolIndex& index,
+    const ClassLayoutSet& layouts,
+    const fs::path& path,
+    bool verbose
+)
+{
+    if (!layouts.asciiCollation)
+    {
+        std::error_code error;
+        fs::remove(path, error);
+        std::cerr << "[luau-docgen] search index skipped: class, member or category names outside ASCII are laid out by "
+                     "generate.js\n";
+        return;
+    }
+
+    SearchIndex search = buildSearchIndex(modules, index, layouts);
+
+    if (path.has_parent_path())
+        fs::create_directories(path.parent_path());
+    std::ofstream searchFile(path, std::ios::binary);
+    writeSearchIndex(modules, index, layouts, search, searchFile);
+
+    if (verbose)
+        std::cerr << "[luau-docgen] search index: " << search.documents.size() << " documents, " << search.terms.size()
+                  << " terms\n";
+}
+
+static void printRenderFailures(const MdxRenderResult& rendered)
+{
+    for (const std::string& path : rendered.failedPaths)
+        std::cerr << "[luau-docgen] failed to write " << normalizePath(rendered.outDir / path) << "\n";
+}
+
+// 한 번의 실행에서 같이 분석하는 패키지. 첫 패키지는 --root/--src/--types/--out이다.
+struct DocgenPackage
+{
+    // rootDir/srcDir/typesDir만 패키지 값으로 바꾼 사본
+    GeneratorOptions options;
+    fs::path outPath;
+    std::unordered_map<std::string, std::string> overrides;
+    // 패키지가 포함하는 파일의 contexts 인덱스 (파일 수집 순서)
+    std::vector<size_t> contexts;
+};
+
+static std::vector<DocgenPackage> resolvePackages(const GeneratorOptions& options, const fs::path& outPath)
+{
+    std::vector<DocgenPackage> packages;
+    packages.push_back({options, outPath, loadModuleOverrides(options.rootDir), {}});
+
+    for (const PackageOptions& package : options.packages)
+    {
+        GeneratorOptions packageOptions = options;
+        packageOptions.rootDir = package.rootDir;
+        packageOptions.srcDir = package.srcDir;
+        packageOptions.typesDir = package.typesDir;
+        packageOptions.packages.clear();
+        packages.push_back({std::move(packageOptions), package.outPath, loadModuleOverrides(package.rootDir), {}});
+    }
+
+    return packages;
+}
+
+// 모든 패키지의 루트, src, types 디렉터리를 포함하는 가장 가까운 디렉터리.
+// 모듈 이름이 '..'로 시작하지 않아야 상대 require가 작업 공간 밖으로 잘리지 않는다.
+static fs::path findWorkspaceDir(const std::vector<DocgenPackage>& packages)
+{
+    fs::path workspace;
+    auto addDir = [&](const fs::path& dir) {
+        if (dir.empty())
+            return;
+
+        fs::path absolute = fs::absolute(dir).lexically_normal();
+        if (workspace.empty())
+        {
+            workspace = absolute;
+            return;
+        }
+
+        fs::path common;
+        for (auto left = workspace.begin(), right = absolute.begin();
+             left != workspace.end() && right != absolute.end() && *left == *right;
+             ++left, ++right)
+            common /= *left;
+        workspace = common;
+    };
+
+    for (const DocgenPackage& package : packages)
+    {
+        addDir(package.options.rootDir);
+        addDir(package.options.srcDir);
+        addDir(package.options.typesDir);
+    }
+    return workspace;
+}
+
+// 여러 패키지가 같은 파일(공유 types 디렉터리 등)을 포함하면 분석과 심볼 생성은 한 번만 하고,
+// 다른 패키지에는 그 패키지 기준 id와 경로로 고친 사본을 넣는다.
+static Module rebaseModule(const Module& shared, const ModuleContext& context, const DocgenPackage& package)
+{
+    Module module = shared;
+    std::string path = normalizePath(fs::relative(context.filePath, package.options.rootDir));
+
+    auto overrideIt = package.overrides.find(path);
+    if (overrideIt != package.overrides.end())
+        module.id = overrideIt->second;
+    else
+        module.id = stripExtension(fs::relative(context.filePath, selectBaseDir(context.filePath, package.options)));
+
+    if (path != shared.path)
+    {
+        for (Symbol& symbol : module.symbols)
+        {
+            if (symbol.file == shared.path)
+                symbol.file = path;
+        }
+        module.path = path;
+    }
+
+    return module;
+}
+
+// contexts 순서의 모듈을 패키지별 목록으로 나눈다. 원본은 파일을 처음 모은 패키지로 옮긴다.
+static std::vector<std::vector<Module>> splitPackageModules(
+    const std::vector<DocgenPackage>& packages,
+    const std::vector<ModuleContext>& contexts,
+    const std::vector<size_t>& owners,
+    std::vector<Module> modules
+)
+{
+    std::vector<std::vector<Module>> result(packages.size());
+    if (packages.size() == 1)
+    {
+        result[0] = std::move(modules);
+        return result;
+    }
+
+    for (size_t p = 0; p < packages.size(); ++p)
+    {
+        result[p].resize(packages[p].contexts.size());
+        for (size_t k = 0; k < packages[p].contexts.size(); ++k)
+        {
+            size_t i = packages[p].contexts[k];
+            if (owners[i] != p)
+                result[p][k] = rebaseModule(modules[i], contexts[i], packages[p]);
+        }
+    }
+
+    for (size_t p = 0; p < packages.size(); ++p)
+    {
+        for (size_t k = 0; k < packages[p].contexts.size(); ++k)
+        {
+            size_t i = packages[p].contexts[k];
+            if (owners[i] == p)
+                result[p][k] = std::move(modules[i]);
+        }
+    }
+
+    return result;
+}
+
+static int runDocgenStages(const GeneratorOptions& options, const fs::path& outPath, bool failOnWarning)
+{
+    std::optional<RenderOptions> renderOptions;
+    if (!options.renderDir.empty())
+    {
+        renderOptions = resolveRenderOptions(options);
+        if (!renderOptions)
+        {
+            std::cerr << "[luau-docgen] invalid render options JSON\n";
+            return 1;
+        }
+    }
+
+    // 패키지마다 파일 목록, 모듈 id, 출력 경로는 따로 두고 Frontend와 파일/설정 리졸버는 하나를 같이 쓴다.
+    std::vector<DocgenPackage> packages = resolvePackages(options, outPath);
+    bool multiRoot = packages.size() > 1;
+    fs::path workspaceDir = multiRoot ? findWorkspaceDir(packages) : fs::path();
+
+    std::optional<MemoryReport> memoryReportStorage;
+    if (options.memoryReport)
+        memoryReportStorage.emplace();
+    MemoryReport* memoryReport = memoryReportStorage ? &*memoryReportStorage : nullptr;
+
+    DocgenStats stats;
+    auto endStage = [&](const char* name) {
+        stats.markStage(name);
+        if (memoryReport)
+            memoryReport->sampleStage(name);
+    };
+
+    // owners[i]: files[i]를 처음 모은 패키지. 여러 패키지에 걸친 같은 파일은 한 번만 분석한다.
+    std::vector<fs::path> files;
+    std::vector<size_t> owners;
+    {
+        DOCGEN_TRACE_SCOPE("collectFiles", "");
+        std::unordered_map<std::string, size_t> fileIndices;
+        for (size_t p = 0; p < packages.size(); ++p)
+        {
+            DocgenPackage& package = packages[p];
+            std::vector<fs::path> packageFiles = collectFiles(package.options.srcDir);
+            if (!package.options.typesDir.empty())
+            {
+                std::vector<fs::path> typeFiles = collectFiles(package.options.typesDir);
+                packageFiles.insert(packageFiles.end(), typeFiles.begin(), typeFiles.end());
+            }
+
+            for (fs::path& filePath : packageFiles)
+            {
+                if (multiRoot)
+                {
+                    auto inserted = fileIndices.emplace(normalizePath(fs::absolute(filePath).lexically_normal()), files.size());
+                    if (!inserted.second)
+                    {
+                        package.contexts.push_back(inserted.first->second);
+                        continue;
+                    }
+                }
+
+                package.contexts.push_back(files.size());
+                files.push_back(std::move(filePath));
+                owners.push_back(p);
+            }
+        }
+    }
+
+    std::vector<Diagnostic> diagnostics;
+    std::vector<ModuleContext> contexts;
+    contexts.reserve(files.size());
+
+    endStage("collectFiles");
+
+    for (size_t i = 0; i < files.size(); ++i)
+    {
+        contexts.push_back(buildModuleContext(files[i], packages[owners[i]].options));
+        if (multiRoot)
+            useWorkspaceModuleName(contexts.back(), workspaceDir);
+    }
+
+    if (memoryReport)
+    {
+        for (const ModuleContext& context : contexts)
+            memoryReport->recordSource(context.moduleName, context.source);
+    }
+
+    // 소스는 모듈을 만들자마자 해제하므로 소스 기준 통계는 여기서 센다.
+    stats.filesScanned = files.size();
+    for (const ModuleContext& context : contexts)
+    {
+        stats.sourceBytes += context.source.rawBytes;
+        stats.docBlocks += context.blocks.size();
+        stats.bindings += context.bindings.size();
+    }
+
+    // 모든 모듈을 모아야 하는 출력(MDX, 검색 인덱스, v2 문자열 표, 여러 패키지)이 없으면
+    // 모듈을 완성되는 대로 쓰고 버린다. 클래스 레이아웃은 스트리밍 출력이 남기는 요약으로 계산한다.
+    bool streamOutput = !multiRoot && options.schemaVersion == 1 && !renderOptions && options.searchIndexPath.empty();
+
+    std::unordered_set<std::string> inheritTargets;
+    if (streamOutput)
+    {
+        for (const ModuleContext& context : contexts)
+            collectInheritDocTargets(context.source, inheritTargets);
+        keepDeclaredInheritDocTargets(contexts, inheritTargets);
+    }
+    endStage("buildModuleContext");
+
+    DocgenConfigResolver configResolver;
+    std::unordered_set<std::string> registeredNames;
+    registeredNames.reserve(contexts.size());
+
+    for (size_t i = 0; i < contexts.size(); ++i)
+    {
+        const ModuleContext& context = contexts[i];
+        if (registeredNames.insert(context.moduleName).second)
+        {
+            configResolver.registerModule(context.moduleName, context.filePath, packages[owners[i]].options.rootDir);
+        }
         else
-            writer.valueString(ret.type);
-        writer.key("description");
-        std::string desc;
-        if (!ret.description.empty())
         {
-            for (size_t i = 0; i < ret.description.size(); ++i)
+            diagnostics.push_back({
+                "warning",
+                context.rootRelativePath,
+                1,
+                "Duplicate module name detected; official type analysis may be incomplete.",
+            });
+        }
+    }
+
+    DocgenFileResolver fileResolver(contexts);
+
+    Luau::FrontendOptions frontendOptions = makeFrontendOptions(options);
+    Luau::Frontend frontend(&fileResolver, &configResolver, frontendOptions);
+    TypeDisplayCache displayCache;
+
+    auto countModule = [&](const Module& module) {
+        stats.modules++;
+        stats.symbols += module.symbols.size();
+        for (const Symbol& symbol : module.symbols)
+            stats.symbolsByKind[symbol.kind]++;
+    };
+
+    // 중간에 실패해도 이전 reference.json이 반쯤 쓴 파일로 바뀌지 않도록 임시 파일에 쓰고 끝나면 바꾼다.
+    std::optional<std::ofstream> streamFile;
+    std::optional<StreamingJsonOutput> stream;
+    fs::path streamTempPath;
+    if (streamOutput)
+    {
+        fs::create_directories(packages[0].outPath.parent_path());
+        streamTempPath = packages[0].outPath;
+        streamTempPath += ".tmp";
+        streamFile.emplace(streamTempPath, std::ios::binary);
+        stream.emplace(*streamFile, options.generatorVersion, std::move(inheritTargets), options.classLayout);
+    }
+
+    std::vector<Module> modules;
+    if (!stream)
+        modules.reserve(contexts.size());
+
+    // 분석이 끝난 뒤라 Frontend가 소스를 다시 읽지 않으므로 모듈을 만들면 바로 소스를 해제한다.
+    auto emitModule = [&](size_t contextIndex, Module module) {
+        ModuleContext& context = contexts[contextIndex];
+        context.source = Source();
+        context.blocks = {};
+        context.bindings = {};
+
+        if (stream)
+        {
+            countModule(module);
+            stream->push(std::move(module));
+        }
+        else
+        {
+            modules.push_back(std::move(module));
+        }
+    };
+    size_t peakLiveModules = 0;
+
+    LazyCheckPlan plan = options.lazyCheck ? planLazyCheck(contexts) : planFullCheck(contexts);
+    loadDefinitionGlobals(frontend, contexts, &displayCache, options.moduleTimeLimitSec, plan);
+    endStage("loadDefinitions");
+
+    const std::vector<bool>* needsAnalysis = &plan.needsAnalysis;
+
+    if (std::optional<double> scale = checkLimitScale(options))
+    {
+        std::vector<std::string> checkedNames;
+        for (size_t i = 0; i < contexts.size(); ++i)
+        {
+            if (plan.needsAnalysis[i])
+                checkedNames.push_back(contexts[i].moduleName);
+        }
+        applyCheckLimits(frontend, checkedNames, scale);
+    }
+
+    std::unique_ptr<ModuleTimeBudget> timeBudget = makeTimeBudget(frontend, options);
+
+    if (options.boundedMemory)
+    {
+        std::vector<std::vector<Diagnostic>> contextDiagnostics;
+        std::vector<std::vector<Symbol>> symbols =
+            runBoundedAnalysis(frontend, contexts, &displayCache, contextDiagnostics, plan, memoryReport, timeBudget.get(), peakLiveModules);
+
+        endStage("analysis+symbols");
+
+        std::vector<Diagnostic> configDiagnostics = configResolver.consumeDiagnostics();
+        diagnostics.insert(diagnostics.end(), configDiagnostics.begin(), configDiagnostics.end());
+
+        for (size_t i = 0; i < contexts.size(); ++i)
+        {
+            if (!plan.needsAnalysis[i])
             {
-                if (i > 0)
-                    desc += "\n";
-                desc += trim(ret.description[i]);
+                contextDiagnostics[i] = std::move(plan.diagnostics[i]);
+                symbols[i] = std::move(plan.symbols[i]);
             }
-            desc = trim(desc);
+
+            if (memoryReport)
+                memoryReport->recordSymbols(contexts[i].moduleName, symbols[i]);
+
+            diagnostics.insert(diagnostics.end(), contextDiagnostics[i].begin(), contextDiagnostics[i].end());
+            emitModule(i, generateModule(contexts[i], options, packages[owners[i]].overrides, std::move(symbols[i])));
         }
-        if (desc.empty())
-            writer.valueNull();
-        else
-            writer.valueString(desc);
-        writer.endObject();
     }
-    writer.endArray();
-}
-
-static void writeErrors(JsonWriter& writer, const std::vector<ErrorInfo>& errors)
-{
-    writer.beginArray();
-    for (const ErrorInfo& err : errors)
+    else
     {
-        writer.beginObject();
-        writer.key("type");
-        if (err.type.empty())
-            writer.valueNull();
-        else
-            writer.valueString(err.type);
-        writer.key("description");
-        std::string desc;
-        if (!err.description.empty())
+        std::unordered_map<std::string, ModuleAnalysis> analyses =
+            runFrontendAnalysis(frontend, contexts, &displayCache, diagnostics, needsAnalysis, memoryReport, timeBudget.get());
+
+        endStage("analysis");
+
+        std::vector<Diagnostic> configDiagnostics = configResolver.consumeDiagnostics();
+        diagnostics.insert(diagnostics.end(), configDiagnostics.begin(), configDiagnostics.end());
+
+        for (size_t i = 0; i < contexts.size(); ++i)
         {
-            for (size_t i = 0; i < err.description.size(); ++i)
+            const ModuleContext& context = contexts[i];
+            if (!plan.needsAnalysis[i])
             {
-                if (i > 0)
-                    desc += "\n";
-                desc += trim(err.description[i]);
+                if (memoryReport)
+                    memoryReport->recordSymbols(context.moduleName, plan.symbols[i]);
+
+                diagnostics.insert(diagnostics.end(), plan.diagnostics[i].begin(), plan.diagnostics[i].end());
+                emitModule(i, generateModule(context, options, packages[owners[i]].overrides, std::move(plan.symbols[i])));
+                continue;
             }
-            desc = trim(desc);
+
+            const ModuleAnalysis* analysis = nullptr;
+            auto it = analyses.find(context.moduleName);
+            if (it != analyses.end())
+                analysis = &it->second;
+
+            std::vector<Symbol> symbols = buildSymbols(context, analysis, diagnostics, plan.parsedDocs(i));
+            if (memoryReport)
+                memoryReport->recordSymbols(context.moduleName, symbols);
+
+            emitModule(i, generateModule(context, options, packages[owners[i]].overrides, std::move(symbols)));
         }
-        if (desc.empty())
-            writer.valueNull();
-        else
-            writer.valueString(desc);
-        writer.endObject();
+
+        endStage("buildSymbols");
     }
-    writer.endArray();
+
+    std::unordered_set<std::string> moduleNames;
+    for (const ModuleContext& context : contexts)
+    {
+        if (context.definition)
+            continue;
+
+        if (moduleNames.insert(context.moduleName).second && !frontend.isDirty(context.moduleName))
+            stats.modulesTypeChecked++;
+    }
+
+    if (options.lazyCheck && options.verbose)
+    {
+        std::cerr << "[luau-docgen] lazy check: skipped " << moduleNames.size() - stats.modulesTypeChecked << " of "
+                  << moduleNames.size() << " module type checks\n";
+    }
+
+    std::optional<MdxRenderResult> rendered;
+    if (stream)
+    {
+        stream->finish();
+        streamFile->close();
+        if (!*streamFile)
+            throw std::runtime_error("failed to write " + streamTempPath.string());
+        fs::rename(streamTempPath, packages[0].outPath);
+        endStage("writeJsonOutput");
+
+        if (options.verbose)
+            std::cerr << "[luau-docgen] streamed output: peak " << stream->peakHeldModules() << " held module(s)\n";
+    }
+    else
+    {
+        std::vector<std::vector<Module>> packageModules = splitPackageModules(packages, contexts, owners, std::move(modules));
+
+        // 심볼 색인(@inheritDoc, @extends)은 패키지를 따로 실행했을 때와 같도록 패키지마다 만든다.
+        std::vector<SymbolIndex> indices;
+        indices.reserve(packages.size());
+        for (std::vector<Module>& packageModule : packageModules)
+        {
+            indices.push_back(buildSymbolIndex(packageModule));
+            applyInheritDocs(packageModule, indices.back());
+        }
+
+        endStage("buildSymbolIndex");
+
+        // 검색 인덱스와 MDX 렌더링은 첫 패키지(사이트)만 대상으로 한다.
+        const std::vector<Module>& primaryModules = packageModules[0];
+        const SymbolIndex& index = indices[0];
+
+        // 검색 인덱스와 MDX 렌더링도 페이지 링크와 앵커가 필요하므로 레이아웃을 한 번만 계산해 같이 쓴다.
+        std::vector<std::optional<ClassLayoutSet>> layouts(packages.size());
+        for (size_t p = 0; p < packages.size(); ++p)
+        {
+            bool primaryNeedsLayout = p == 0 && (!options.searchIndexPath.empty() || renderOptions);
+            if (options.classLayout || primaryNeedsLayout)
+                layouts[p] = buildClassLayouts(packageModules[p], indices[p]);
+        }
+
+        if (renderOptions)
+        {
+            rendered = renderMdxPages(primaryModules, index, *layouts[0], *renderOptions, options.renderDir);
+            printRenderFailures(*rendered);
+            endStage("renderMdx");
+        }
+
+        for (size_t p = 0; p < packages.size(); ++p)
+        {
+            const fs::path& packageOutPath = packages[p].outPath;
+            fs::create_directories(packageOutPath.parent_path());
+            std::ofstream outFile(packageOutPath, std::ios::binary);
+            writeJsonOutput(
+                packageModules[p],
+                indices[p],
+                options.generatorVersion,
+                options.schemaVersion,
+                options.classLayout || (p == 0 && rendered) ? &*layouts[p] : nullptr,
+                p == 0 && rendered ? &*rendered : nullptr,
+                outFile
+            );
+        }
+
+        endStage("writeJsonOutput");
+
+        if (!options.searchIndexPath.empty())
+        {
+            writeSearchIndexFile(primaryModules, index, *layouts[0], options.searchIndexPath, options.verbose);
+            endStage("writeSearchIndex");
+        }
+
+        for (const std::vector<Module>& packageModule : packageModules)
+        {
+            for (const Module& module : packageModule)
+                countModule(module);
+        }
+    }
+
+    if (!options.statsPath.empty())
+    {
+        stats.diagnostics = diagnostics.size();
+        stats.typeDisplayHits = displayCache.hits;
+        stats.typeDisplayMisses = displayCache.misses;
+        stats.requireCacheHits = fileResolver.requireCacheHits;
+        stats.requireCacheMisses = fileResolver.requireCacheMisses;
+
+        if (options.statsPath.has_parent_path())
+            fs::create_directories(options.statsPath.parent_path());
+        std::ofstream statsFile(options.statsPath, std::ios::binary);
+        writeStatsOutput(stats, options.generatorVersion, statsFile);
+    }
+
+    if (!diagnostics.empty())
+        printDiagnostics(diagnostics);
+
+    if (options.verbose)
+    {
+        std::cerr << "[luau-docgen] type display cache: " << displayCache.hits << " hits, " << displayCache.misses
+                  << " misses\n";
+        std::cerr << "[luau-docgen] require cache: " << fileResolver.requireCacheHits << " hits, "
+                  << fileResolver.requireCacheMisses << " misses\n";
+        std::cerr << "[luau-docgen] source scan kernel: " << scanKernelName(detectScanKernel()) << "\n";
+        if (options.boundedMemory)
+            std::cerr << "[luau-docgen] bounded memory: peak " << peakLiveModules << " live module(s) of "
+                      << contexts.size() << "\n";
+        if (multiRoot)
+        {
+            size_t packageFiles = 0;
+            for (const DocgenPackage& package : packages)
+                packageFiles += package.contexts.size();
+            std::cerr << "[luau-docgen] packages: " << packages.size() << " roots, " << contexts.size()
+                      << " analyzed module(s) for " << packageFiles << " package file(s)\n";
+        }
+    }
+
+    if (memoryReport)
+        printMemoryReport(*memoryReport, 10);
+
+    if (rendered && !rendered->failedPaths.empty())
+        return 1;
+
+    if (failOnWarning && !diagnostics.empty())
+        return 1;
+
+    return 0;
 }
 
-static void writeFields(JsonWriter& writer, const std::vector<FieldInfo>& fields)
+static int runDocgen(const GeneratorOptions& options, const fs::path& outPath, bool failOnWarning)
 {
-    writer.beginArray();
-    for (const FieldInfo& field : fields)
+    if (!options.tracePath.empty())
     {
-        writer.beginObject();
-        writer.key("name");
-        writer.valueString(field.name);
-        writer.key("type");
-        if (field.type.empty())
-            writer.valueNull();
-        else
-            writer.valueString(field.type);
-        writer.key("description");
-        if (field.description.empty())
-            writer.valueNull();
-        else
-            writer.valueString(field.description);
-        writer.endObject();
+#ifdef LUAU_DOCGEN_TRACING
+        docgenTracer().start();
+#else
+        std::cerr << "[luau-docgen] --trace ignored: built without LUAU_DOCGEN_ENABLE_TRACING\n";
+#endif
     }
-    writer.endArray();
+
+    int exitCode = 0;
+    {
+        DOCGEN_TRACE_SCOPE("runDocgen", "");
+        exitCode = runDocgenStages(options, outPath, failOnWarning);
+    }
+
+#ifdef LUAU_DOCGEN_TRACING
+    if (!options.tracePath.empty())
+        finishTrace(options.tracePath);
+#endif
+
+    return exitCode;
 }
 
-static void writeSymbol(JsonWriter& writer, const Symbol& symbol)
+// value가 비어 있으면 fallback(없으면 빈 경로)을 쓰고, 상대 경로는 rootDir 기준으로 푼다.
+static fs::path resolveUnderRoot(const char* value, const fs::path& rootDir, const char* fallback)
 {
-    writer.beginObject();
-    writer.key("kind");
-    writer.valueString(symbol.kind);
-    writer.key("name");
-    writer.valueString(symbol.name);
-    writer.key("qualifiedName");
-    writer.valueString(symbol.qualifiedName);
-    writer.key("location");
-    writer.beginObject();
-    writer.key("file");
-    writer.valueString(symbol.file);
-    writer.key("line");
-    writer.valueNumber(symbol.line);
-    writer.key("column");
-    writer.valueNumber(symbol.column);
-    writer.endObject();
+    if (!value || std::strlen(value) == 0)
+        return fallback ? rootDir / fallback : fs::path();
 
-    writer.key("docs");
-    writer.beginObject();
-    writer.key("summary");
-    writer.valueString(symbol.summary);
-    writer.key("descriptionMarkdown");
-    writer.valueString(symbol.descriptionMarkdown);
-    writer.key("tags");
-    writeTagArray(writer, symbol.tags);
-    writer.key("examples");
-    writer.beginArray();
-    writer.endArray();
-    writer.endObject();
+    fs::path path(value);
+    return path.is_absolute() ? path : rootDir / path;
+}
 
-    writer.key("types");
-    writer.beginObject();
-    writer.key("display");
-    writer.valueString(symbol.types.display);
-    writer.key("structured");
-    writer.beginObject();
-    if (symbol.kind == "function" || symbol.kind == "constructor")
+static GeneratorOptions resolveGeneratorOptions(const LuauDocgenOptions* options, fs::path& outPath)
+{
+    GeneratorOptions resolved;
+    fs::path rootDir = fs::current_path();
+
+    if (options->root_dir && std::strlen(options->root_dir) > 0)
+        rootDir = fs::path(options->root_dir);
+
+    resolved.rootDir = rootDir;
+    resolved.generatorVersion = "0.0.0";
+
+    if (options->generator_version && std::strlen(options->generator_version) > 0)
+        resolved.generatorVersion = options->generator_version;
+
+    if (options->src_dir && std::strlen(options->src_dir) > 0)
     {
-        writer.key("params");
-        writeParams(writer, symbol.types.params);
-        writer.key("returns");
-        writeReturns(writer, symbol.types.returns);
-        writer.key("errors");
-        writeErrors(writer, symbol.types.errors);
-        writer.key("yields");
-        writer.valueBool(symbol.types.yields);
+        fs::path srcDir = fs::path(options->src_dir);
+        resolved.srcDir = srcDir.is_absolute() ? srcDir : rootDir / srcDir;
     }
-    else if (symbol.kind == "property")
+    else
     {
-        writer.key("type");
-        if (symbol.types.propertyType.empty())
-            writer.valueNull();
-        else
-            writer.valueString(symbol.types.propertyType);
-        writer.key("readonly");
-        writer.valueBool(symbol.types.readonly);
+        resolved.srcDir = rootDir / "src";
     }
-    else if (symbol.kind == "interface")
+
+    if (options->types_dir && std::strlen(options->types_dir) > 0)
+    {
+        fs::path typesDir = fs::path(options->types_dir);
+        resolved.typesDir = typesDir.is_absolute() ? typesDir : rootDir / typesDir;
+    }
+
+    outPath = rootDir / "reference.json";
+    if (options->out_path && std::strlen(options->out_path) > 0)
+    {
+        fs::path output = fs::path(options->out_path);
+        outPath = output.is_absolute() ? output : rootDir / output;
+    }
+
+    resolved.verbose = options->verbose != 0;
+    resolved.boundedMemory = options->bounded_memory != 0;
+    resolved.lazyCheck = options->lazy_check != 0;
+    resolved.memoryReport = options->memory_report != 0;
+    resolved.classLayout = options->class_layout != 0;
+
+    if (options->trace_path && std::strlen(options->trace_path) > 0)
+    {
+        fs::path tracePath = fs::path(options->trace_path);
+        resolved.tracePath = tracePath.is_absolute() ? tracePath : rootDir / tracePath;
+    }
+
+    if (options->stats_path && std::strlen(options->stats_path) > 0)
+    {
+        fs::path statsPath = fs::path(options->stats_path);
+        resolved.statsPath = statsPath.is_absolute() ? statsPath : rootDir / statsPath;
+    }
+
+    if (options->search_index_path && std::strlen(options->search_index_path) > 0)
+    {
+        fs::path searchIndexPath = fs::path(options->search_index_path);
+        resolved.searchIndexPath = searchIndexPath.is_absolute() ? searchIndexPath : rootDir / searchIndexPath;
+    }
+
+    if (options->render_dir && std::strlen(options->render_dir) > 0)
+    {
+        fs::path renderDir = fs::path(options->render_dir);
+        resolved.renderDir = renderDir.is_absolute() ? renderDir : rootDir / renderDir;
+    }
+
+    if (options->render_options_json)
+        resolved.renderOptionsJson = options->render_options_json;
+
+    if (options->schema_version == 2)
+        resolved.schemaVersion = 2;
+
+    for (size_t i = 0; options->packages && i < options->package_count; ++i)
+    {
+        const LuauDocgenPackageOptions& package = options->packages[i];
+        if (!package.root_dir || std::strlen(package.root_dir) == 0)
+            continue;
+
+        PackageOptions resolvedPackage;
+        resolvedPackage.rootDir = fs::path(package.root_dir);
+        resolvedPackage.srcDir = resolveUnderRoot(package.src_dir, resolvedPackage.rootDir, "src");
+        resolvedPackage.typesDir = resolveUnderRoot(package.types_dir, resolvedPackage.rootDir, nullptr);
+        resolvedPackage.outPath = resolveUnderRoot(package.out_path, resolvedPackage.rootDir, "reference.json");
+        resolved.packages.push_back(std::move(resolvedPackage));
+    }
+
+    // 0은 설정하지 않음이다. 음수는 조용히 무시하지 않고 거부한다.
+    if (options->module_time_limit_sec < 0)
+        throw std::invalid_argument("module_time_limit_sec must not be negative");
+    if (options->instantiation_limit < 0)
+        throw std::invalid_argument("instantiation_limit must not be negative");
+    if (options->unifier_iteration_limit < 0)
+        throw std::invalid_argument("unifier_iteration_limit must not be negative");
+
+    if (options->module_time_limit_sec > 0)
+        resolved.moduleTimeLimitSec = options->module_time_limit_sec;
+    if (options->instantiation_limit > 0)
+        resolved.instantiationLimit = options->instantiation_limit;
+    if (options->unifier_iteration_limit > 0)
+        resolved.unifierIterationLimit = options->unifier_iteration_limit;
+
+    return resolved;
+}
+
+extern "C" int luau_docgen_run(const LuauDocgenOptions* options)
+{
+    if (!options)
+        return LUAU_DOCGEN_ERROR;
+
+    fs::path outPath;
+    GeneratorOptions resolved;
+    try
+    {
+        resolved = resolveGeneratorOptions(options, outPath);
+    }
+    catch (const std::exception& error)
+    {
+        std::cerr << "[luau-docgen] invalid options: " << error.what() << "\n";
+        return LUAU_DOCGEN_ERROR;
+    }
+    bool failOnWarning = options->fail_on_warning != 0;
+
+    return runDocgen(resolved, outPath, failOnWarning);
+}
+
+struct SessionModule
+{
+    ModuleContext context;
+    // false면 다음 generate에서 다시 만든다. 결과는 세션 outputModules의 같은 위치에 있다.
+    bool upToDate = false;
+    // 상속을 적용하기 전의 @inheritDoc 심볼. 대상 모듈만 바뀌어도 다시 상속할 수 있게 둔다.
+    std::vector<std::pair<size_t, Symbol>> inheritSources;
+    std::vector<Diagnostic> diagnostics;
+};
+
+// 세션은 Frontend와 모듈별 결과를 유지하고, 바뀐 파일과 그 dependent만 다시 분석한다.
+struct LuauDocgenSession
+{
+    GeneratorOptions options;
+    bool failOnWarning = false;
+    std::unordered_map<std::string, std::string> overrides;
+    std::optional<RenderOptions> renderOptions;
+
+    std::list<SessionModule> modules;
+    std::unordered_map<std::string, std::list<SessionModule>::iterator> modulesByPath;
+
+    DocgenFileResolver fileResolver;
+    DocgenConfigResolver configResolver;
+    // 얼린 전역 환경은 되돌릴 수 없으므로 정의 파일이 바뀌면 Frontend를 새로 만든다.
+    std::unique_ptr<Luau::Frontend> frontend;
+    bool definitionsLoaded = false;
+    TypeDisplayCache displayCache;
+    std::vector<Diagnostic> configDiagnostics;
+
+    // modules와 같은 순서다. 모듈은 다시 만들 때만 교체하고 generate마다 복사하지 않는다.
+    std::vector<Module> outputModules;
+    SymbolIndex index;
+    std::string output;
+    bool outputValid = false;
+    int status = LUAU_DOCGEN_OK;
+
+    LuauDocgenSession(const GeneratorOptions& options, bool failOnWarning)
+        : options(options)
+        , failOnWarning(failOnWarning)
+        , overrides(loadModuleOverrides(options.rootDir))
+        , frontend(std::make_unique<Luau::Frontend>(&fileResolver, &configResolver, makeFrontendOptions(options)))
     {
-        writer.key("fields");
-        writeFields(writer, symbol.types.fields);
+        // 타입 그래프를 놓아 버리면 다음 generate에서 재사용할 수 없다.
+        if (options.boundedMemory)
+            throw std::invalid_argument("bounded_memory is not supported by sessions");
+
+        fileResolver.trackRequires = true;
+
+        if (!options.renderDir.empty())
+        {
+            renderOptions = resolveRenderOptions(options);
+            if (!renderOptions)
+                throw std::runtime_error("invalid render options JSON");
+        }
     }
-    else if (symbol.kind == "type")
+
+    fs::path resolvePath(const char* path) const
     {
-        writer.key("type");
-        if (symbol.types.typeAlias.empty())
-            writer.valueNull();
-        else
-            writer.valueString(symbol.types.typeAlias);
+        fs::path filePath(path);
+        if (!filePath.is_absolute())
+            filePath = options.rootDir / filePath;
+        return filePath.lexically_normal();
     }
-    else if (symbol.kind == "class")
+
+    static std::string pathKey(const fs::path& filePath)
     {
-        writer.key("indexName");
-        if (symbol.types.indexName.empty())
-            writer.valueNull();
-        else
-            writer.valueString(symbol.types.indexName);
+        return normalizePath(fs::absolute(filePath).lexically_normal());
     }
-    else if (symbol.kind == "field")
+
+    void addModule(ModuleContext context)
     {
-        writer.key("type");
-        if (symbol.types.propertyType.empty())
-            writer.valueNull();
-        else
-            writer.valueString(symbol.types.propertyType);
+        std::string key = pathKey(context.filePath);
+        modules.push_back(SessionModule{std::move(context), false, {}, {}});
+        outputModules.emplace_back();
+
+        auto inserted = std::prev(modules.end());
+        modulesByPath[key] = inserted;
+        registerResolvable(inserted->context);
     }
-    writer.endObject();
-    writer.endObject();
 
-    writer.key("visibility");
-    writer.valueString(symbol.visibility);
+    // 정의 파일은 require 대상 모듈이 아니다.
+    void registerResolvable(const ModuleContext& context)
+    {
+        if (context.definition)
+            return;
 
-    writer.endObject();
-}
+        fileResolver.registerModule(context);
+        configResolver.registerModule(context.moduleName, context.filePath, options.rootDir);
+    }
 
-static void writeJsonOutput(
-    const std::vector<Module>& modules,
-    const std::string& generatorVersion,
-    std::ostream& out
-)
-{
-    JsonWriter writer(out);
-    writer.beginObject();
-    writer.key("schemaVersion");
-    writer.valueNumber(1);
-    writer.key("generatorVersion");
-    writer.valueString(generatorVersion);
-    writer.key("luauVersion");
-    writer.valueNull();
-    writer.key("modules");
-    writer.beginArray();
-    for (const Module& module : modules)
+    void storeModule(size_t position, SessionModule& entry, std::vector<Symbol> symbols)
     {
-        writer.beginObject();
-        writer.key("id");
-        writer.valueString(module.id);
-        writer.key("path");
-        writer.valueString(module.path);
-        writer.key("sourceHash");
-        writer.valueString(module.sourceHash);
-        writer.key("symbols");
-        writer.beginArray();
-        for (const Symbol& symbol : module.symbols)
-            writeSymbol(writer, symbol);
-        writer.endArray();
-        writer.endObject();
-    }
-    writer.endArray();
-    writer.endObject();
-    out << "\n";
-}
+        Module module = generateModule(entry.context, options, overrides, std::move(symbols));
 
-static Module generateModule(
-    const ModuleContext& context,
-    const GeneratorOptions& options,
-    const std::unordered_map<std::string, std::string>& moduleOverrides,
-    const ModuleAnalysis* analysis,
-    std::vector<Diagnostic>& diagnostics
-)
-{
-    (void)options;
+        entry.inheritSources.clear();
+        for (size_t i = 0; i < module.symbols.size(); ++i)
+        {
+            if (findInheritDocTarget(module.symbols[i]))
+                entry.inheritSources.emplace_back(i, module.symbols[i]);
+        }
 
-    std::vector<Symbol> symbols = buildSymbols(context, analysis, diagnostics);
-    applyInheritDocs(symbols);
+        outputModules[position] = std::move(module);
+        entry.upToDate = true;
+    }
 
-    std::string moduleId = context.moduleName;
-    auto overrideIt = moduleOverrides.find(context.rootRelativePath);
-    if (overrideIt != moduleOverrides.end())
-        moduleId = overrideIt->second;
+    void markDirty(const std::string& moduleName)
+    {
+        std::vector<Luau::ModuleName> marked;
+        frontend->markDirty(moduleName, &marked);
 
-    Module module;
-    module.id = moduleId;
-    module.path = context.rootRelativePath;
-    module.sourceHash = sha1(context.source.rawContent);
-    module.symbols = std::move(symbols);
-    return module;
-}
+        std::unordered_set<std::string> dirtyNames(marked.begin(), marked.end());
+        dirtyNames.insert(moduleName);
 
-static void printDiagnostics(const std::vector<Diagnostic>& diagnostics)
-{
-    for (const Diagnostic& diagnostic : diagnostics)
-    {
-        std::string level = diagnostic.level;
-        std::transform(level.begin(), level.end(), level.begin(), [](unsigned char ch) {
-            return std::toupper(ch);
-        });
-        std::cerr << "[luau-docgen] " << level << " " << diagnostic.file << ":" << diagnostic.line << " "
-                  << diagnostic.message << "\n";
+        for (SessionModule& entry : modules)
+        {
+            if (!entry.context.definition && dirtyNames.find(entry.context.moduleName) != dirtyNames.end())
+                entry.upToDate = false;
+        }
+        outputValid = false;
     }
-}
 
-static int runDocgen(const GeneratorOptions& options, const fs::path& outPath, bool failOnWarning)
-{
-    std::unordered_map<std::string, std::string> overrides = loadModuleOverrides(options.rootDir);
+    // 모듈 집합이 바뀌면 require 결과가 달라진 모듈과 그 dependent만 다시 검사한다.
+    void markChangedRequirers()
+    {
+        for (const std::string& moduleName : fileResolver.takeChangedRequirers())
+            markDirty(moduleName);
+        outputValid = false;
+    }
 
-    std::vector<fs::path> files = collectFiles(options.srcDir);
-    if (!options.typesDir.empty())
+    void reloadDefinitions()
     {
-        std::vector<fs::path> typeFiles = collectFiles(options.typesDir);
-        files.insert(files.end(), typeFiles.begin(), typeFiles.end());
+        frontend = std::make_unique<Luau::Frontend>(&fileResolver, &configResolver, makeFrontendOptions(options));
+        definitionsLoaded = false;
+        displayCache.clear();
+        for (SessionModule& entry : modules)
+            entry.upToDate = false;
+        outputValid = false;
     }
 
-    std::vector<Diagnostic> diagnostics;
-    std::vector<ModuleContext> contexts;
-    contexts.reserve(files.size());
+    void loadDefinitions()
+    {
+        DOCGEN_TRACE_SCOPE("loadDefinitionGlobals", "");
+        Luau::registerBuiltinGlobals(*frontend, frontend->globals);
+
+        size_t position = 0;
+        for (SessionModule& entry : modules)
+        {
+            size_t current = position++;
+            if (!entry.context.definition)
+                continue;
 
-    for (const fs::path& filePath : files)
-        contexts.push_back(buildModuleContext(filePath, options));
+            entry.diagnostics.clear();
+            std::vector<Symbol> symbols = loadDefinitionModule(*frontend, entry.context, &displayCache, options.moduleTimeLimitSec, entry.diagnostics);
+            storeModule(current, entry, std::move(symbols));
+        }
 
-    std::unordered_map<std::string, fs::path> modulePaths;
-    modulePaths.reserve(contexts.size());
+        Luau::freeze(frontend->globals.globalTypes);
+        definitionsLoaded = true;
+    }
 
-    for (const ModuleContext& context : contexts)
+    void updateFile(const char* path, std::string contents)
     {
-        auto inserted = modulePaths.emplace(context.moduleName, context.filePath);
-        if (!inserted.second)
+        fs::path filePath = resolvePath(path);
+        auto it = modulesByPath.find(pathKey(filePath));
+        if (it != modulesByPath.end())
         {
-            diagnostics.push_back({
-                "warning",
-                context.rootRelativePath,
-                1,
-                "Duplicate module name detected; official type analysis may be incomplete.",
-            });
+            SessionModule& entry = *it->second;
+            entry.context = buildModuleContext(entry.context.filePath, makeSource(std::move(contents)), options);
+            if (entry.context.definition)
+                reloadDefinitions();
+            else
+                markDirty(entry.context.moduleName);
+            return;
         }
+
+        ModuleContext context = buildModuleContext(filePath, makeSource(std::move(contents)), options);
+        bool definition = context.definition;
+        addModule(std::move(context));
+        if (definition)
+            reloadDefinitions();
+        else
+            markChangedRequirers();
     }
 
-    DocgenFileResolver fileResolver(contexts);
-    DocgenConfigResolver configResolver(options.rootDir, modulePaths);
+    bool removeFile(const char* path)
+    {
+        auto it = modulesByPath.find(pathKey(resolvePath(path)));
+        if (it == modulesByPath.end())
+            return false;
 
-    Luau::FrontendOptions frontendOptions;
-    frontendOptions.retainFullTypeGraphs = true;
+        auto entryIt = it->second;
+        size_t position = static_cast<size_t>(std::distance(modules.begin(), entryIt));
+        std::string moduleName = entryIt->context.moduleName;
+        bool definition = entryIt->context.definition;
 
-    Luau::Frontend frontend(&fileResolver, &configResolver, frontendOptions);
-    std::unordered_map<std::string, ModuleAnalysis> analyses = runFrontendAnalysis(frontend, contexts);
+        if (!definition)
+        {
+            fileResolver.unregisterModule(entryIt->context);
+            configResolver.unregisterModule(moduleName);
+        }
+        modules.erase(entryIt);
+        outputModules.erase(outputModules.begin() + static_cast<std::ptrdiff_t>(position));
+        modulesByPath.erase(it);
 
-    std::vector<Diagnostic> configDiagnostics = configResolver.consumeDiagnostics();
-    diagnostics.insert(diagnostics.end(), configDiagnostics.begin(), configDiagnostics.end());
+        // 이름이 같은 다른 파일이 있으면 그 파일이 이름을 이어받는다.
+        for (const SessionModule& entry : modules)
+        {
+            if (!definition && !entry.context.definition && entry.context.moduleName == moduleName)
+            {
+                registerResolvable(entry.context);
+                break;
+            }
+        }
 
-    std::vector<Module> modules;
-    modules.reserve(contexts.size());
+        if (definition)
+        {
+            reloadDefinitions();
+            return true;
+        }
 
-    for (const ModuleContext& context : contexts)
+        markDirty(moduleName);
+        markChangedRequirers();
+        return true;
+    }
+
+    int generate()
     {
-        const ModuleAnalysis* analysis = nullptr;
-        auto it = analyses.find(context.moduleName);
-        if (it != analyses.end())
-            analysis = &it->second;
+        if (outputValid)
+            return status;
 
-        modules.push_back(generateModule(context, options, overrides, analysis, diagnostics));
-    }
+        if (!definitionsLoaded)
+            loadDefinitions();
 
-    fs::create_directories(outPath.parent_path());
-    std::ofstream outFile(outPath, std::ios::binary);
-    writeJsonOutput(modules, options.generatorVersion, outFile);
+        bool anyDirty = std::any_of(modules.begin(), modules.end(), [](const SessionModule& entry) {
+            return !entry.upToDate;
+        });
+        if (anyDirty)
+            displayCache.clear();
 
-    if (!diagnostics.empty())
-        printDiagnostics(diagnostics);
+        if (std::optional<double> scale = checkLimitScale(options))
+        {
+            std::vector<std::string> dirtyNames;
+            for (const SessionModule& entry : modules)
+            {
+                if (!entry.upToDate && !entry.context.definition)
+                    dirtyNames.push_back(entry.context.moduleName);
+            }
+            applyCheckLimits(*frontend, dirtyNames, scale);
+        }
 
-    if (failOnWarning && !diagnostics.empty())
-        return 1;
+        std::unique_ptr<ModuleTimeBudget> timeBudget = makeTimeBudget(*frontend, options);
 
-    return 0;
-}
+        std::vector<Diagnostic> diagnostics;
+        std::unordered_set<std::string> seenNames;
+        for (const SessionModule& entry : modules)
+        {
+            if (!seenNames.insert(entry.context.moduleName).second)
+            {
+                diagnostics.push_back({
+                    "warning",
+                    entry.context.rootRelativePath,
+                    1,
+                    "Duplicate module name detected; official type analysis may be incomplete.",
+                });
+            }
+        }
 
-extern "C" int luau_docgen_run(const LuauDocgenOptions* options)
+        size_t position = 0;
+        for (SessionModule& entry : modules)
+        {
+            size_t current = position++;
+            if (entry.upToDate)
+                continue;
+
+            entry.diagnostics.clear();
+            std::vector<ParsedDoc> docs = parseModuleDocs(entry.context);
+
+            // --lazy-check와 같다. 타입 없이 만든 심볼로 충분하면 검사하지 않는다.
+            if (options.lazyCheck)
+            {
+                std::vector<Diagnostic> lazyDiagnostics;
+                std::vector<Symbol> symbols = buildSymbols(entry.context, nullptr, lazyDiagnostics, &docs);
+                if (std::none_of(symbols.begin(), symbols.end(), symbolNeedsAnalysis))
+                {
+                    entry.diagnostics = std::move(lazyDiagnostics);
+                    storeModule(current, entry, std::move(symbols));
+                    continue;
+                }
+            }
+
+            checkModule(*frontend, timeBudget.get(), entry.context.moduleName);
+
+            Luau::ModulePtr module = frontend->moduleResolver.getModule(entry.context.moduleName);
+            std::optional<ModuleAnalysis> analysis;
+            if (isWithinBudget(module, entry.context, timeBudget.get(), entry.diagnostics) && module && module->hasModuleScope())
+            {
+                analysis = ModuleAnalysis{
+                    entry.context.moduleName,
+                    module,
+                    module->getModuleScope(),
+                    &displayCache,
+                };
+            }
+
+            std::vector<Symbol> symbols = buildSymbols(entry.context, analysis ? &*analysis : nullptr, entry.diagnostics, &docs);
+            storeModule(current, entry, std::move(symbols));
+        }
+
+        std::vector<Diagnostic> newConfigDiagnostics = configResolver.consumeDiagnostics();
+        configDiagnostics.insert(configDiagnostics.end(), newConfigDiagnostics.begin(), newConfigDiagnostics.end());
+        diagnostics.insert(diagnostics.end(), configDiagnostics.begin(), configDiagnostics.end());
+
+        // 이전 generate에서 상속한 내용을 원래대로 돌린 뒤 다시 상속한다.
+        position = 0;
+        for (const SessionModule& entry : modules)
+        {
+            Module& module = outputModules[position++];
+            diagnostics.insert(diagnostics.end(), entry.diagnostics.begin(), entry.diagnostics.end());
+            for (const auto& [symbolIndex, symbol] : entry.inheritSources)
+                module.symbols[symbolIndex] = symbol;
+        }
+
+        index = buildSymbolIndex(outputModules);
+        applyInheritDocs(outputModules, index);
+
+        std::optional<ClassLayoutSet> layouts;
+        if (options.classLayout || renderOptions || !options.searchIndexPath.empty())
+            layouts = buildClassLayouts(outputModules, index);
+
+        std::optional<MdxRenderResult> rendered;
+        if (renderOptions)
+        {
+            rendered = renderMdxPages(outputModules, index, *layouts, *renderOptions, options.renderDir);
+            printRenderFailures(*rendered);
+        }
+
+        std::ostringstream out;
+        writeJsonOutput(
+            outputModules,
+            index,
+            options.generatorVersion,
+            options.schemaVersion,
+            options.classLayout || rendered ? &*layouts : nullptr,
+            rendered ? &*rendered : nullptr,
+            out
+        );
+        output = out.str();
+
+        if (!options.searchIndexPath.empty())
+            writeSearchIndexFile(outputModules, index, *layouts, options.searchIndexPath, options.verbose);
+
+        if (!diagnostics.empty())
+            printDiagnostics(diagnostics);
+
+        status = failOnWarning && !diagnostics.empty() ? LUAU_DOCGEN_WARNINGS : LUAU_DOCGEN_OK;
+        if (rendered && !rendered->failedPaths.empty())
+            status = LUAU_DOCGEN_ERROR;
+        outputValid = true;
+        return status;
+    }
+};
+
+extern "C" LuauDocgenSession* luau_docgen_session_create(const LuauDocgenOptions* options)
 {
     if (!options)
-        return 1;
+        return nullptr;
 
-    GeneratorOptions resolved;
-    fs::path rootDir = fs::current_path();
+    try
+    {
+        fs::path outPath;
+        GeneratorOptions resolved = resolveGeneratorOptions(options, outPath);
+        auto session = std::make_unique<LuauDocgenSession>(resolved, options->fail_on_warning != 0);
 
-    if (options->root_dir && std::strlen(options->root_dir) > 0)
-        rootDir = fs::path(options->root_dir);
+        std::vector<fs::path> files = collectFiles(resolved.srcDir);
+        if (!resolved.typesDir.empty())
+        {
+            std::vector<fs::path> typeFiles = collectFiles(resolved.typesDir);
+            files.insert(files.end(), typeFiles.begin(), typeFiles.end());
+        }
 
-    resolved.rootDir = rootDir;
-    resolved.generatorVersion = "0.0.0";
+        for (const fs::path& filePath : files)
+            session->addModule(buildModuleContext(filePath.lexically_normal(), resolved));
 
-    if (options->generator_version && std::strlen(options->generator_version) > 0)
-        resolved.generatorVersion = options->generator_version;
+        return session.release();
+    }
+    catch (const std::exception& error)
+    {
+        std::cerr << "[luau-docgen] failed to create session: " << error.what() << "\n";
+        return nullptr;
+    }
+}
 
-    if (options->src_dir && std::strlen(options->src_dir) > 0)
+extern "C" int luau_docgen_session_update_file(
+    LuauDocgenSession* session,
+    const char* path,
+    const char* contents,
+    size_t size
+)
+{
+    if (!session || !path || (!contents && size > 0))
+        return LUAU_DOCGEN_ERROR;
+
+    try
     {
-        fs::path srcDir = fs::path(options->src_dir);
-        resolved.srcDir = srcDir.is_absolute() ? srcDir : rootDir / srcDir;
+        session->updateFile(path, std::string(contents ? contents : "", size));
+        return LUAU_DOCGEN_OK;
     }
-    else
+    catch (const std::exception& error)
     {
-        resolved.srcDir = rootDir / "src";
+        std::cerr << "[luau-docgen] failed to update " << path << ": " << error.what() << "\n";
+        return LUAU_DOCGEN_ERROR;
     }
+}
 
-    if (options->types_dir && std::strlen(options->types_dir) > 0)
+extern "C" int luau_docgen_session_remove_file(LuauDocgenSession* session, const char* path)
+{
+    if (!session || !path)
+        return LUAU_DOCGEN_ERROR;
+
+    try
     {
-        fs::path typesDir = fs::path(options->types_dir);
-        resolved.typesDir = typesDir.is_absolute() ? typesDir : rootDir / typesDir;
+        return session->removeFile(path) ? LUAU_DOCGEN_OK : LUAU_DOCGEN_ERROR;
     }
+    catch (const std::exception& error)
+    {
+        std::cerr << "[luau-docgen] failed to remove " << path << ": " << error.what() << "\n";
+        return LUAU_DOCGEN_ERROR;
+    }
+}
 
-    fs::path outPath = rootDir / "reference.json";
-    if (options->out_path && std::strlen(options->out_path) > 0)
+extern "C" int luau_docgen_session_generate(
+    LuauDocgenSession* session,
+    char* buffer,
+    size_t capacity,
+    size_t* out_size
+)
+{
+    if (!session)
+        return LUAU_DOCGEN_ERROR;
+
+    try
     {
-        fs::path output = fs::path(options->out_path);
-        outPath = output.is_absolute() ? output : rootDir / output;
+        int status = session->generate();
+        if (out_size)
+            *out_size = session->output.size();
+
+        if (!buffer || capacity < session->output.size())
+            return LUAU_DOCGEN_BUFFER_TOO_SMALL;
+
+        std::memcpy(buffer, session->output.data(), session->output.size());
+        return status;
     }
+    catch (const std::exception& error)
+    {
+        std::cerr << "[luau-docgen] failed to generate: " << error.what() << "\n";
+        return LUAU_DOCGEN_ERROR;
+    }
+}
 
-    bool failOnWarning = options->fail_on_warning != 0;
+extern "C" int luau_docgen_session_generate_modules(
+    LuauDocgenSession* session,
+    LuauDocgenModuleCallback callback,
+    void* user_data
+)
+{
+    if (!session || !callback)
+        return LUAU_DOCGEN_ERROR;
 
-    return runDocgen(resolved, outPath, failOnWarning);
+    try
+    {
+        int status = session->generate();
+
+        // schema_version 2의 문자열 테이블은 문서 전체 단위라 모듈 JSON은 항상 v1로 쓴다.
+        for (const Module& module : session->outputModules)
+        {
+            std::ostringstream out;
+            JsonWriter writer(out);
+            writeModule(writer, module);
+
+            std::string json = out.str();
+            callback(module.id.c_str(), json.data(), json.size(), user_data);
+        }
+
+        return status;
+    }
+    catch (const std::exception& error)
+    {
+        std::cerr << "[luau-docgen] failed to generate: " << error.what() << "\n";
+        return LUAU_DOCGEN_ERROR;
+    }
+}
+
+extern "C" void luau_docgen_session_destroy(LuauDocgenSession* session)
+{
+    delete session;
 }
@@ -0,0 +1,323 @@
+#include <node_api.h>
+
+#include <optional>
+#include <string>
+
+#include "luau_docgen.h"
+
+// JS 쪽에서 destroySession을 먼저 호출해도 finalizer가 안전하도록 세션 포인터를 한 번 감싼다.
+struct SessionHandle
+{
+    LuauDocgenSession* session = nullptr;
+};
+
+static bool throwIfFailed(napi_env env, napi_status status)
+{
+    if (status == napi_ok)
+        return false;
+
+    bool pending = false;
+    napi_is_exception_pending(env, &pending);
+    if (pending)
+        return true;
+
+    const napi_extended_error_info* info = nullptr;
+    napi_get_last_error_info(env, &info);
+    napi_throw_error(env, nullptr, info && info->error_message ? info->error_message : "Node-API call failed");
+    return true;
+}
+
+static std::optional<std::string> readString(napi_env env, napi_value value)
+{
+    napi_valuetype type = napi_undefined;
+    if (napi_typeof(env, value, &type) != napi_ok || type != napi_string)
+        return std::nullopt;
+
+    size_t length = 0;
+    if (napi_get_value_string_utf8(env, value, nullptr, 0, &length) != napi_ok)
+        return std::nullopt;
+
+    std::string result(length, '\0');
+    if (napi_get_value_string_utf8(env, value, result.data(), length + 1, &length) != napi_ok)
+        return std::nullopt;
+
+    return result;
+}
+
+static napi_value getProperty(napi_env env, napi_value object, const char* name)
+{
+    bool has = false;
+    if (napi_has_named_property(env, object, name, &has) != napi_ok || !has)
+        return nullptr;
+
+    napi_value value = nullptr;
+    if (napi_get_named_property(env, object, name, &value) != napi_ok)
+        return nullptr;
+
+    return value;
+}
+
+static std::optional<std::string> getStringProperty(napi_env env, napi_value object, const char* name)
+{
+    napi_value value = getProperty(env, object, name);
+    return value ? readString(env, value) : std::nullopt;
+}
+
+static double getNumberProperty(napi_env env, napi_value object, const char* name)
+{
+    napi_value value = getProperty(env, object, name);
+    double result = 0;
+    if (!value || napi_get_value_double(env, value, &result) != napi_ok)
+        return 0;
+
+    return result;
+}
+
+static bool getBoolProperty(napi_env env, napi_value object, const char* name)
+{
+    napi_value value = getProperty(env, object, name);
+    bool result = false;
+    if (!value || napi_get_value_bool(env, value, &result) != napi_ok)
+        return false;
+
+    return result;
+}
+
+static LuauDocgenSession* getSession(napi_env env, napi_value value)
+{
+    void* data = nullptr;
+    if (napi_get_value_external(env, value, &data) != napi_ok || !data)
+    {
+        napi_throw_type_error(env, nullptr, "Expected a luau-docgen session");
+        return nullptr;
+    }
+
+    SessionHandle* handle = static_cast<SessionHandle*>(data);
+    if (!handle->session)
+    {
+        napi_throw_error(env, nullptr, "luau-docgen session was already destroyed");
+        return nullptr;
+    }
+
+    return handle->session;
+}
+
+static napi_value makeInt(napi_env env, int value)
+{
+    napi_value result = nullptr;
+    napi_create_int32(env, value, &result);
+    return result;
+}
+
+static void finalizeSession(napi_env, void* data, void*)
+{
+    SessionHandle* handle = static_cast<SessionHandle*>(data);
+    if (handle->session)
+        luau_docgen_session_destroy(handle->session);
+    delete handle;
+}
+
+// createSession({ rootDir, srcDir, typesDir, generatorVersion, failOnWarning, ... })
+static napi_value createSession(napi_env env, napi_callback_info info)
+{
+    size_t argc = 1;
+    napi_value argv[1] = {nullptr};
+    if (throwIfFailed(env, napi_get_cb_info(env, info, &argc, argv, nullptr, nullptr)))
+        return nullptr;
+
+    napi_valuetype type = napi_undefined;
+    if (argc < 1 || napi_typeof(env, argv[0], &type) != napi_ok || type != napi_object)
+    {
+        napi_throw_type_error(env, nullptr, "createSession expects an options object");
+        return nullptr;
+    }
+
+    std::optional<std::string> rootDir = getStringProperty(env, argv[0], "rootDir");
+    std::optional<std::string> srcDir = getStringProperty(env, argv[0], "srcDir");
+    std::optional<std::string> typesDir = getStringProperty(env, argv[0], "typesDir");
+    std::optional<std::string> generatorVersion = getStringProperty(env, argv[0], "generatorVersion");
+    std::optional<std::string> renderDir = getStringProperty(env, argv[0], "renderDir");
+    std::optional<std::string> renderOptions = getStringProperty(env, argv[0], "renderOptions");
+    std::optional<std::string> searchIndexPath = getStringProperty(env, argv[0], "searchIndexPath");
+
+    LuauDocgenOptions options = {};
+    options.root_dir = rootDir ? rootDir->c_str() : nullptr;
+    options.src_dir = srcDir ? srcDir->c_str() : nullptr;
+    options.types_dir = typesDir ? typesDir->c_str() : nullptr;
+    options.generator_version = generatorVersion ? generatorVersion->c_str() : nullptr;
+    options.fail_on_warning = getBoolProperty(env, argv[0], "failOnWarning") ? 1 : 0;
+    options.module_time_limit_sec = getNumberProperty(env, argv[0], "moduleTimeLimitSec");
+    options.instantiation_limit = static_cast<int>(getNumberProperty(env, argv[0], "instantiationLimit"));
+    options.unifier_iteration_limit = static_cast<int>(getNumberProperty(env, argv[0], "unifierIterationLimit"));
+    options.lazy_check = getBoolProperty(env, argv[0], "lazyCheck") ? 1 : 0;
+    options.class_layout = getBoolProperty(env, argv[0], "classLayout") ? 1 : 0;
+    options.render_dir = renderDir ? renderDir->c_str() : nullptr;
+    options.render_options_json = renderOptions ? renderOptions->c_str() : nullptr;
+    options.search_index_path = searchIndexPath ? searchIndexPath->c_str() : nullptr;
+    options.schema_version = static_cast<int>(getNumberProperty(env, argv[0], "schemaVersion"));
+
+    LuauDocgenSession* session = luau_docgen_session_create(&options);
+    if (!session)
+    {
+        napi_throw_error(env, nullptr, "Failed to create luau-docgen session");
+        return nullptr;
+    }
+
+    SessionHandle* handle = new SessionHandle{session};
+    napi_value result = nullptr;
+    if (throwIfFailed(env, napi_create_external(env, handle, finalizeSession, nullptr, &result)))
+    {
+        finalizeSession(env, handle, nullptr);
+        return nullptr;
+    }
+
+    return result;
+}
+
+// updateFile(session, path, contents: string | Buffer)
+static napi_value updateFile(napi_env env, napi_callback_info info)
+{
+    size_t argc = 3;
+    napi_value argv[3] = {nullptr, nullptr, nullptr};
+    if (throwIfFailed(env, napi_get_cb_info(env, info, &argc, argv, nullptr, nullptr)))
+        return nullptr;
+
+    LuauDocgenSession* session = argc >= 1 ? getSession(env, argv[0]) : nullptr;
+    if (!session)
+        return nullptr;
+
+    std::optional<std::string> path = argc >= 2 ? readString(env, argv[1]) : std::nullopt;
+    if (!path)
+    {
+        napi_throw_type_error(env, nullptr, "updateFile expects a path string");
+        return nullptr;
+    }
+
+    bool isBuffer = false;
+    if (argc >= 3)
+        napi_is_buffer(env, argv[2], &isBuffer);
+
+    if (isBuffer)
+    {
+        void* data = nullptr;
+        size_t length = 0;
+        if (throwIfFailed(env, napi_get_buffer_info(env, argv[2], &data, &length)))
+            return nullptr;
+
+        return makeInt(env, luau_docgen_session_update_file(session, path->c_str(), static_cast<const char*>(data), length));
+    }
+
+    std::optional<std::string> contents = argc >= 3 ? readString(env, argv[2]) : std::nullopt;
+    if (!contents)
+    {
+        napi_throw_type_error(env, nullptr, "updateFile expects contents as a string or Buffer");
+        return nullptr;
+    }
+
+    return makeInt(env, luau_docgen_session_update_file(session, path->c_str(), contents->data(), contents->size()));
+}
+
+// removeFile(session, path)
+static napi_value removeFile(napi_env env, napi_callback_info info)
+{
+    size_t argc = 2;
+    napi_value argv[2] = {nullptr, nullptr};
+    if (throwIfFailed(env, napi_get_cb_info(env, info, &argc, argv, nullptr, nullptr)))
+        return nullptr;
+
+    LuauDocgenSession* session = argc >= 1 ? getSession(env, argv[0]) : nullptr;
+    if (!session)
+        return nullptr;
+
+    std::optional<std::string> path = argc >= 2 ? readString(env, argv[1]) : std::nullopt;
+    if (!path)
+    {
+        napi_throw_type_error(env, nullptr, "removeFile expects a path string");
+        return nullptr;
+    }
+
+    return makeInt(env, luau_docgen_session_remove_file(session, path->c_str()));
+}
+
+// generate(session) -> { status, output: ArrayBuffer }
+// 출력은 JS가 소유하는 ArrayBuffer에 바로 복사하므로 중간 문자열이나 파일을 거치지 않는다.
+static napi_value generate(napi_env env, napi_callback_info info)
+{
+    size_t argc = 1;
+    napi_value argv[1] = {nullptr};
+    if (throwIfFailed(env, napi_get_cb_info(env, info, &argc, argv, nullptr, nullptr)))
+        return nullptr;
+
+    LuauDocgenSession* session = argc >= 1 ? getSession(env, argv[0]) : nullptr;
+    if (!session)
+        return nullptr;
+
+    size_t size = 0;
+    int status = luau_docgen_session_generate(session, nullptr, 0, &size);
+    if (status == LUAU_DOCGEN_ERROR)
+    {
+        napi_throw_error(env, nullptr, "luau-docgen generation failed");
+        return nullptr;
+    }
+
+    void* data = nullptr;
+    napi_value output = nullptr;
+    if (throwIfFailed(env, napi_create_arraybuffer(env, size, &data, &output)))
+        return nullptr;
+
+    status = luau_docgen_session_generate(session, static_cast<char*>(data), size, &size);
+    if (status == LUAU_DOCGEN_ERROR || status == LUAU_DOCGEN_BUFFER_TOO_SMALL)
+    {
+        napi_throw_error(env, nullptr, "luau-docgen generation failed");
+        return nullptr;
+    }
+
+    napi_value result = nullptr;
+    if (throwIfFailed(env, napi_create_object(env, &result)))
+        return nullptr;
+
+    napi_set_named_property(env, result, "status", makeInt(env, status));
+    napi_set_named_property(env, result, "output", output);
+    return result;
+}
+
+// destroySession(session)
+static napi_value destroySession(napi_env env, napi_callback_info info)
+{
+    size_t argc = 1;
+    napi_value argv[1] = {nullptr};
+    if (throwIfFailed(env, napi_get_cb_info(env, info, &argc, argv, nullptr, nullptr)))
+        return nullptr;
+
+    void* data = nullptr;
+    if (argc < 1 || napi_get_value_external(env, argv[0], &data) != napi_ok || !data)
+    {
+        napi_throw_type_error(env, nullptr, "Expected a luau-docgen session");
+        return nullptr;
+    }
+
+    SessionHandle* handle = static_cast<SessionHandle*>(data);
+    if (handle->session)
+    {
+        luau_docgen_session_destroy(handle->session);
+        handle->session = nullptr;
+    }
+
+    return nullptr;
+}
+
+NAPI_MODULE_INIT()
+{
+    napi_property_descriptor properties[] = {
+        {"createSession", nullptr, createSession, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"updateFile", nullptr, updateFile, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"removeFile", nullptr, removeFile, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"generate", nullptr, generate, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"destroySession", nullptr, destroySession, nullptr, nullptr, nullptr, napi_default, nullptr},
+    };
+
+    if (napi_define_properties(env, exports, sizeof(properties) / sizeof(properties[0]), properties) != napi_ok)
+        return nullptr;
+
+    return exports;
+}
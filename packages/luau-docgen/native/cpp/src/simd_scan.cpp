@@ -0,0 +1,230 @@
+#include "simd_scan.h"
+
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define LUAU_DOCGEN_SCAN_X64 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(LUAU_DOCGEN_SCAN_X64) && (defined(__GNUC__) || defined(__clang__))
+#define LUAU_DOCGEN_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define LUAU_DOCGEN_TARGET_AVX2
+#endif
+
+// 블록 사이에 걸친 "--"를 잇기 위해 직전 바이트가 '-'였는지를 들고 다닌다.
+struct ScanState
+{
+    LineScan& result;
+    bool previousDash = false;
+
+    void newline(size_t position)
+    {
+        result.lineOffsets.push_back(position + 1);
+        result.lineHasDashes.push_back(false);
+    }
+
+    void dashes()
+    {
+        result.lineHasDashes.back() = true;
+    }
+};
+
+static unsigned countTrailingZeros(uint32_t value)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index = 0;
+    _BitScanForward(&index, value);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctz(value));
+#endif
+}
+
+// '\n'과 '-'의 비트 마스크(비트 i = base + i번째 바이트)를 받아 이벤트를 순서대로 처리한다.
+// "--"는 두 번째 '-' 위치에서 센다. 두 '-'는 같은 줄에 있으므로 어느 쪽으로 세어도 결과가 같다.
+static void consumeMasks(ScanState& state, size_t base, unsigned width, uint32_t newlines, uint32_t dashes)
+{
+    uint32_t pairs = dashes & ((dashes << 1) | (state.previousDash ? 1u : 0u));
+    state.previousDash = (dashes >> (width - 1)) & 1u;
+
+    uint32_t events = newlines | pairs;
+    while (events)
+    {
+        unsigned bit = countTrailingZeros(events);
+        if (newlines & (1u << bit))
+            state.newline(base + bit);
+        else
+            state.dashes();
+        events &= events - 1;
+    }
+}
+
+// 블록 경계에서 남은 꼬리와 스칼라 구현이 같이 쓴다. '\r'을 만나면 false
+static bool scanScalar(ScanState& state, const char* data, size_t begin, size_t end)
+{
+    for (size_t i = begin; i < end; ++i)
+    {
+        char ch = data[i];
+        if (ch == '\r')
+            return false;
+
+        if (ch == '\n')
+        {
+            state.newline(i);
+            state.previousDash = false;
+        }
+        else if (ch == '-')
+        {
+            if (state.previousDash)
+                state.dashes();
+            state.previousDash = true;
+        }
+        else
+        {
+            state.previousDash = false;
+        }
+    }
+    return true;
+}
+
+#if defined(LUAU_DOCGEN_SCAN_X64)
+
+static bool scanSse2(ScanState& state, const char* data, size_t size)
+{
+    const __m128i newline = _mm_set1_epi8('\n');
+    const __m128i carriageReturn = _mm_set1_epi8('\r');
+    const __m128i dash = _mm_set1_epi8('-');
+
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16)
+    {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(block, carriageReturn)) != 0)
+            return false;
+
+        uint32_t newlines = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, newline)));
+        uint32_t dashes = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, dash)));
+        if ((newlines | dashes) == 0)
+        {
+            state.previousDash = false;
+            continue;
+        }
+        consumeMasks(state, i, 16, newlines, dashes);
+    }
+
+    return scanScalar(state, data, i, size);
+}
+
+LUAU_DOCGEN_TARGET_AVX2 static bool scanAvx2(ScanState& state, const char* data, size_t size)
+{
+    const __m256i newline = _mm256_set1_epi8('\n');
+    const __m256i carriageReturn = _mm256_set1_epi8('\r');
+    const __m256i dash = _mm256_set1_epi8('-');
+
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32)
+    {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, carriageReturn)) != 0)
+            return false;
+
+        uint32_t newlines = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, newline)));
+        uint32_t dashes = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, dash)));
+        if ((newlines | dashes) == 0)
+        {
+            state.previousDash = false;
+            continue;
+        }
+        consumeMasks(state, i, 32, newlines, dashes);
+    }
+
+    return scanScalar(state, data, i, size);
+}
+
+static bool cpuSupportsAvx2()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4] = {};
+    __cpuid(info, 0);
+    if (info[0] < 7)
+        return false;
+
+    __cpuid(info, 1);
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool avx = (info[2] & (1 << 28)) != 0;
+    if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6)
+        return false;
+
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#endif
+
+ScanKernel detectScanKernel()
+{
+#if defined(LUAU_DOCGEN_SCAN_X64)
+    static const ScanKernel kernel = cpuSupportsAvx2() ? ScanKernel::Avx2 : ScanKernel::Sse2;
+    return kernel;
+#else
+    return ScanKernel::Scalar;
+#endif
+}
+
+const char* scanKernelName(ScanKernel kernel)
+{
+    switch (kernel)
+    {
+    case ScanKernel::Avx2:
+        return "avx2";
+    case ScanKernel::Sse2:
+        return "sse2";
+    default:
+        return "scalar";
+    }
+}
+
+LineScan scanLines(std::string_view text)
+{
+    return scanLines(text, detectScanKernel());
+}
+
+LineScan scanLines(std::string_view text, ScanKernel kernel)
+{
+    LineScan result;
+    result.lineOffsets.push_back(0);
+    result.lineHasDashes.push_back(false);
+
+    ScanState state{result};
+    bool completed = false;
+    switch (kernel)
+    {
+#if defined(LUAU_DOCGEN_SCAN_X64)
+    case ScanKernel::Avx2:
+        completed = scanAvx2(state, text.data(), text.size());
+        break;
+    case ScanKernel::Sse2:
+        completed = scanSse2(state, text.data(), text.size());
+        break;
+#endif
+    default:
+        completed = scanScalar(state, text.data(), 0, text.size());
+        break;
+    }
+
+    if (!completed)
+    {
+        result = LineScan();
+        result.hasCarriageReturn = true;
+    }
+    return result;
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+// 소스 버퍼를 한 번 훑어 줄 경계, '\r', "--" 위치를 찾는 바이트 스캔 커널.
+// x86-64에서는 실행 중에 AVX2/SSE2 중 쓸 수 있는 것을 고르고, 그 밖의 CPU에서는 스칼라 구현을 쓴다.
+// 세 구현의 결과는 같다.
+
+enum class ScanKernel
+{
+    Scalar,
+    Sse2,
+    Avx2,
+};
+
+struct LineScan
+{
+    // 줄 시작 오프셋. 항상 0으로 시작하고 줄 수만큼 있다.
+    std::vector<size_t> lineOffsets;
+    // 줄 안에 "--"가 있는지. 문서 블록과 주석은 이 줄들에서만 시작할 수 있다.
+    std::vector<bool> lineHasDashes;
+    // '\r'을 만나면 바로 멈추고 true로 돌려준다. 이때 나머지 필드는 비어 있으며,
+    // 호출하는 쪽이 줄 끝을 정규화한 뒤 다시 스캔한다.
+    bool hasCarriageReturn = false;
+};
+
+ScanKernel detectScanKernel();
+const char* scanKernelName(ScanKernel kernel);
+
+LineScan scanLines(std::string_view text);
+LineScan scanLines(std::string_view text, ScanKernel kernel);
@@ -1,6 +1,15 @@
 use std::env;
 use std::ffi::CString;
 use std::os::raw::c_char;
+use std::path::Path;
+
+#[repr(C)]
+struct LuauDocgenPackageOptions {
+    root_dir: *const c_char,
+    src_dir: *const c_char,
+    types_dir: *const c_char,
+    out_path: *const c_char,
+}
 
 #[repr(C)]
 struct LuauDocgenOptions {
@@ -10,12 +19,36 @@ struct LuauDocgenOptions {
     out_path: *const c_char,
     generator_version: *const c_char,
     fail_on_warning: i32,
+    verbose: i32,
+    bounded_memory: i32,
+    lazy_check: i32,
+    module_time_limit_sec: f64,
+    instantiation_limit: i32,
+    unifier_iteration_limit: i32,
+    trace_path: *const c_char,
+    memory_report: i32,
+    stats_path: *const c_char,
+    class_layout: i32,
+    search_index_path: *const c_char,
+    render_dir: *const c_char,
+    render_options_json: *const c_char,
+    schema_version: i32,
+    packages: *const LuauDocgenPackageOptions,
+    package_count: usize,
 }
 
 extern "C" {
     fn luau_docgen_run(options: *const LuauDocgenOptions) -> i32;
 }
 
+#[derive(Default)]
+struct PackageArgs {
+    root_dir: String,
+    src_dir: Option<String>,
+    types_dir: Option<String>,
+    out_path: Option<String>,
+}
+
 #[derive(Default)]
 struct Args {
     root_dir: Option<String>,
@@ -24,6 +57,21 @@ struct Args {
     out_path: Option<String>,
     generator_version: Option<String>,
     fail_on_warning: bool,
+    verbose: bool,
+    bounded_memory: bool,
+    lazy_check: bool,
+    module_time_limit_sec: Option<f64>,
+    instantiation_limit: Option<i32>,
+    unifier_iteration_limit: Option<i32>,
+    trace_path: Option<String>,
+    memory_report: bool,
+    stats_path: Option<String>,
+    class_layout: bool,
+    search_index_path: Option<String>,
+    render_dir: Option<String>,
+    render_options_path: Option<String>,
+    schema_version: Option<i32>,
+    packages: Vec<PackageArgs>,
     help: bool,
 }
 
@@ -31,6 +79,7 @@ fn print_help() {
     println!("luau-docgen");
     println!("\nUsage:");
     println!("  luau-docgen --out <path> [--root <dir>] [--src <dir>] [--types <dir>]");
+    println!("              [--package <dir> [--src <dir>] [--types <dir>] [--out <path>]]...");
     println!("\nOptions:");
     println!("  --root <dir>             Root directory (default: cwd)");
     println!("  --src <dir>              Source directory (default: <root>/src)");
@@ -38,6 +87,22 @@ fn print_help() {
     println!("  --out <path>             Output JSON path (default: reference.json)");
     println!("  --generator-version <v>  Generator version string");
     println!("  --fail-on-warning        Exit with non-zero when warnings exist");
+    println!("  --verbose                Print analysis cache statistics");
+    println!("  --bounded-memory         Release module type graphs once all dependents are extracted");
+    println!("  --lazy-check             Type-check only modules whose docs lack types");
+    println!("  --module-time-limit <s>  Per-module type check time budget in seconds");
+    println!("  --instantiation-limit <n> Per-module instantiation child limit (upper bound)");
+    println!("  --unifier-limit <n>      Per-module unifier iteration limit (upper bound)");
+    println!("  --trace <path>           Write a Chrome trace of docgen stages (tracing builds only)");
+    println!("  --memory-report          Print RSS per stage and the heaviest modules to stderr");
+    println!("  --stats <path>           Write generation counters and stage times as JSON");
+    println!("  --class-layout           Add page paths, sections and anchors to the class index");
+    println!("  --search-index <path>    Write a prebuilt search index (terms, postings, pages) as JSON");
+    println!("  --render-mdx <dir>       Render class and overview MDX pages into <dir>");
+    println!("  --render-options <path>  Render options JSON written by the reference plugin");
+    println!("  --schema-version <n>     Output schema: 1 (default) or 2 (compact, shared string table)");
+    println!("  --package <dir>          Add a package root analyzed with the same type checker;");
+    println!("                           following --src/--types/--out apply to this package");
 }
 
 fn parse_args() -> Result<Args, String> {
@@ -52,15 +117,24 @@ fn parse_args() -> Result<Args, String> {
             }
             "--src" => {
                 let value = iter.next().ok_or("--src requires a value")?;
-                args.src_dir = Some(value);
+                match args.packages.last_mut() {
+                    Some(package) => package.src_dir = Some(value),
+                    None => args.src_dir = Some(value),
+                }
             }
             "--types" => {
                 let value = iter.next().ok_or("--types requires a value")?;
-                args.types_dir = Some(value);
+                match args.packages.last_mut() {
+                    Some(package) => package.types_dir = Some(value),
+                    None => args.types_dir = Some(value),
+                }
             }
             "--out" => {
                 let value = iter.next().ok_or("--out requires a value")?;
-                args.out_path = Some(value);
+                match args.packages.last_mut() {
+                    Some(package) => package.out_path = Some(value),
+                    None => args.out_path = Some(value),
+                }
             }
             "--generator-version" => {
                 let value = iter.next().ok_or("--generator-version requires a value")?;
@@ -69,6 +143,84 @@ fn parse_args() -> Result<Args, String> {
             "--fail-on-warning" => {
                 args.fail_on_warning = true;
             }
+            "--verbose" => {
+                args.verbose = true;
+            }
+            "--bounded-memory" => {
+                args.bounded_memory = true;
+            }
+            "--lazy-check" => {
+                args.lazy_check = true;
+            }
+            "--module-time-limit" => {
+                let value = iter.next().ok_or("--module-time-limit requires a value")?;
+                let seconds = value
+                    .parse::<f64>()
+                    .ok()
+                    .filter(|seconds| seconds.is_finite() && *seconds > 0.0)
+                    .ok_or_else(|| format!("Invalid --module-time-limit (expected seconds > 0): {}", value))?;
+                args.module_time_limit_sec = Some(seconds);
+            }
+            "--instantiation-limit" => {
+                let value = iter.next().ok_or("--instantiation-limit requires a value")?;
+                let limit = value
+                    .parse::<i32>()
+                    .ok()
+                    .filter(|limit| *limit > 0)
+                    .ok_or_else(|| format!("Invalid --instantiation-limit (expected a positive integer): {}", value))?;
+                args.instantiation_limit = Some(limit);
+            }
+            "--unifier-limit" => {
+                let value = iter.next().ok_or("--unifier-limit requires a value")?;
+                let limit = value
+                    .parse::<i32>()
+                    .ok()
+                    .filter(|limit| *limit > 0)
+                    .ok_or_else(|| format!("Invalid --unifier-limit (expected a positive integer): {}", value))?;
+                args.unifier_iteration_limit = Some(limit);
+            }
+            "--trace" => {
+                let value = iter.next().ok_or("--trace requires a value")?;
+                args.trace_path = Some(value);
+            }
+            "--memory-report" => {
+                args.memory_report = true;
+            }
+            "--stats" => {
+                let value = iter.next().ok_or("--stats requires a value")?;
+                args.stats_path = Some(value);
+            }
+            "--class-layout" => {
+                args.class_layout = true;
+            }
+            "--search-index" => {
+                let value = iter.next().ok_or("--search-index requires a value")?;
+                args.search_index_path = Some(value);
+            }
+            "--render-mdx" => {
+                let value = iter.next().ok_or("--render-mdx requires a value")?;
+                args.render_dir = Some(value);
+            }
+            "--render-options" => {
+                let value = iter.next().ok_or("--render-options requires a value")?;
+                args.render_options_path = Some(value);
+            }
+            "--schema-version" => {
+                let value = iter.next().ok_or("--schema-version requires a value")?;
+                let version = match value.as_str() {
+                    "1" => 1,
+                    "2" => 2,
+                    _ => return Err(format!("Invalid --schema-version: {}", value)),
+                };
+                args.schema_version = Some(version);
+            }
+            "--package" => {
+                let value = iter.next().ok_or("--package requires a value")?;
+                args.packages.push(PackageArgs {
+                    root_dir: value,
+                    ..PackageArgs::default()
+                });
+            }
             "-h" | "--help" => {
                 args.help = true;
             }
@@ -85,6 +237,16 @@ fn to_cstring(value: Option<String>) -> Option<CString> {
     value.map(|item| CString::new(item).unwrap())
 }
 
+// 다른 경로 옵션과 마찬가지로 상대 경로는 --root 기준으로 읽는다.
+fn read_render_options(root_dir: Option<&String>, value: &str) -> Result<String, String> {
+    let path = match root_dir {
+        Some(root) if Path::new(value).is_relative() => Path::new(root).join(value),
+        _ => Path::new(value).to_path_buf(),
+    };
+    std::fs::read_to_string(&path)
+        .map_err(|error| format!("Failed to read --render-options {}: {}", path.display(), error))
+}
+
 fn main() {
     let parsed = match parse_args() {
         Ok(args) => args,
@@ -100,16 +262,58 @@ fn main() {
         return;
     }
 
+    let render_options = match parsed.render_options_path.as_deref() {
+        Some(value) => match read_render_options(parsed.root_dir.as_ref(), value) {
+            Ok(contents) => Some(contents),
+            Err(message) => {
+                eprintln!("[luau-docgen] {}", message);
+                std::process::exit(1);
+            }
+        },
+        None => None,
+    };
+
     let root_dir = to_cstring(parsed.root_dir);
     let src_dir = to_cstring(parsed.src_dir);
     let types_dir = to_cstring(parsed.types_dir);
     let out_path = to_cstring(parsed.out_path);
+    let trace_path = to_cstring(parsed.trace_path);
+    let stats_path = to_cstring(parsed.stats_path);
+    let search_index_path = to_cstring(parsed.search_index_path);
+    let render_dir = to_cstring(parsed.render_dir);
+    let render_options_json = to_cstring(render_options);
     let generator_version = to_cstring(
         parsed
             .generator_version
             .or_else(|| Some(env!("CARGO_PKG_VERSION").to_string())),
     );
 
+    // CString은 luau_docgen_run이 끝날 때까지 package_strings가 들고 있는다.
+    let package_strings: Vec<[Option<CString>; 4]> = parsed
+        .packages
+        .into_iter()
+        .map(|package| {
+            [
+                to_cstring(Some(package.root_dir)),
+                to_cstring(package.src_dir),
+                to_cstring(package.types_dir),
+                to_cstring(package.out_path),
+            ]
+        })
+        .collect();
+    let packages: Vec<LuauDocgenPackageOptions> = package_strings
+        .iter()
+        .map(|values| {
+            let ptr = |value: &Option<CString>| value.as_ref().map_or(std::ptr::null(), |item| item.as_ptr());
+            LuauDocgenPackageOptions {
+                root_dir: ptr(&values[0]),
+                src_dir: ptr(&values[1]),
+                types_dir: ptr(&values[2]),
+                out_path: ptr(&values[3]),
+            }
+        })
+        .collect();
+
     let options = LuauDocgenOptions {
         root_dir: root_dir.as_ref().map_or(std::ptr::null(), |value| value.as_ptr()),
         src_dir: src_dir.as_ref().map_or(std::ptr::null(), |value| value.as_ptr()),
@@ -119,6 +323,28 @@ fn main() {
             .as_ref()
             .map_or(std::ptr::null(), |value| value.as_ptr()),
         fail_on_warning: if parsed.fail_on_warning { 1 } else { 0 },
+        verbose: if parsed.verbose { 1 } else { 0 },
+        bounded_memory: if parsed.bounded_memory { 1 } else { 0 },
+        lazy_check: if parsed.lazy_check { 1 } else { 0 },
+        module_time_limit_sec: parsed.module_time_limit_sec.unwrap_or(0.0),
+        instantiation_limit: parsed.instantiation_limit.unwrap_or(0),
+        unifier_iteration_limit: parsed.unifier_iteration_limit.unwrap_or(0),
+        trace_path: trace_path.as_ref().map_or(std::ptr::null(), |value| value.as_ptr()),
+        memory_report: if parsed.memory_report { 1 } else { 0 },
+        stats_path: stats_path.as_ref().map_or(std::ptr::null(), |value| value.as_ptr()),
+        class_layout: if parsed.class_layout { 1 } else { 0 },
+        search_index_path: search_index_path.as_ref().map_or(std::ptr::null(), |value| value.as_ptr()),
+        render_dir: render_dir.as_ref().map_or(std::ptr::null(), |value| value.as_ptr()),
+        render_options_json: render_options_json
+            .as_ref()
+            .map_or(std::ptr::null(), |value| value.as_ptr()),
+        schema_version: parsed.schema_version.unwrap_or(1),
+        packages: if packages.is_empty() {
+            std::ptr::null()
+        } else {
+            packages.as_ptr()
+        },
+        package_count: packages.len(),
     };
 
     let exit_code = unsafe { luau_docgen_run(&options) };
@@ -0,0 +1,239 @@
+#!/usr/bin/env node
+/*
+합성 프로젝트를 크기별로 만들어 네이티브 luau-docgen을 끝까지 돌리는 스케일링 벤치마크입니다.
+모듈 수별 처리량(modules/s), 최대 RSS, 단계별 시간(--stats)을 출력합니다.
+*/
+const fs = require("fs");
+const os = require("os");
+const path = require("path");
+const { spawnSync } = require("child_process");
+const { generateProject } = require("./synthetic-project.js");
+
+function parseArgs(argv) {
+  const args = {
+    sizes: [100, 1000, 10000],
+    seed: 1,
+    runs: 1,
+    binary: process.env.LUAU_DOCGEN_PATH || null,
+    workDir: path.join(os.tmpdir(), "luau-docgen-scaling"),
+    json: null,
+    trace: false,
+    extraArgs: [],
+  };
+
+  for (let i = 0; i < argv.length; i += 1) {
+    const arg = argv[i];
+
+    if (arg === "--sizes" && argv[i + 1]) {
+      args.sizes = argv[i + 1]
+        .split(",")
+        .map((value) => Number.parseInt(value.trim(), 10))
+        .filter((value) => Number.isFinite(value) && value > 0);
+      i += 1;
+      continue;
+    }
+
+    if (arg === "--seed" && argv[i + 1]) {
+      args.seed = Number.parseInt(argv[i + 1], 10);
+      i += 1;
+      continue;
+    }
+
+    if (arg === "--runs" && argv[i + 1]) {
+      args.runs = Math.max(1, Number.parseInt(argv[i + 1], 10));
+      i += 1;
+      continue;
+    }
+
+    if (arg === "--binary" && argv[i + 1]) {
+      args.binary = argv[i + 1];
+      i += 1;
+      continue;
+    }
+
+    if (arg === "--work-dir" && argv[i + 1]) {
+      args.workDir = argv[i + 1];
+      i += 1;
+      continue;
+    }
+
+    if (arg === "--json" && argv[i + 1]) {
+      args.json = argv[i + 1];
+      i += 1;
+      continue;
+    }
+
+    if (arg === "--trace") {
+      args.trace = true;
+      continue;
+    }
+
+    // `--` 뒤의 인자는 그대로 네이티브 바이너리에 넘긴다 (예: -- --bounded-memory).
+    if (arg === "--") {
+      args.extraArgs = argv.slice(i + 1);
+      break;
+    }
+
+    if (arg === "-h" || arg === "--help") {
+      args.help = true;
+      continue;
+    }
+  }
+
+  return args;
+}
+
+function printHelp() {
+  console.log("bench-scaling");
+  console.log("\nUsage:");
+  console.log("  node scripts/bench-scaling.js [--sizes 100,1000,10000] [--binary <path>] [-- <docgen args>]");
+  console.log("\nOptions:");
+  console.log("  --sizes <list>       Comma separated module counts (default: 100,1000,10000)");
+  console.log("  --seed <n>           Generator seed (default: 1)");
+  console.log("  --runs <n>           Runs per size; the fastest is reported (default: 1)");
+  console.log("  --binary <path>      Native luau-docgen binary (default: LUAU_DOCGEN_PATH or native build)");
+  console.log("  --work-dir <dir>     Where generated projects are kept (default: <tmp>/luau-docgen-scaling)");
+  console.log("  --json <path>        Also write results as JSON");
+  console.log("  --trace              Also keep a Chrome trace per run in <project>/trace.json (tracing builds only)");
+}
+
+function findNativeBinary() {
+  const ext = process.platform === "win32" ? ".exe" : "";
+  const baseDir = path.resolve(__dirname, "..", "native");
+  const candidates = [
+    path.join(baseDir, "bin", `luau-docgen${ext}`),
+    path.join(baseDir, "target", "release", `luau-docgen${ext}`),
+  ];
+
+  for (const candidate of candidates) {
+    if (fs.existsSync(candidate)) {
+      return candidate;
+    }
+  }
+
+  return null;
+}
+
+function parsePeakRss(stderr) {
+  const match = /\[luau-docgen\] memory: peak_rss_bytes=(\d+)/.exec(stderr);
+  return match ? Number.parseInt(match[1], 10) : null;
+}
+
+// --stats 사이드카의 stagesUs를 단계별 ms로 바꾼다.
+function readStageTimes(statsPath) {
+  if (!fs.existsSync(statsPath)) {
+    return null;
+  }
+
+  const stats = JSON.parse(fs.readFileSync(statsPath, "utf8"));
+  const stages = {};
+  for (const [name, micros] of Object.entries(stats.stagesUs || {})) {
+    stages[name] = micros / 1000;
+  }
+
+  return stages;
+}
+
+function runOnce(binary, projectDir, args) {
+  const outPath = path.join(projectDir, "reference.json");
+  const statsPath = path.join(projectDir, "stats.json");
+  const nativeArgs = [
+    "--root",
+    projectDir,
+    "--src",
+    "src",
+    "--out",
+    outPath,
+    "--memory-report",
+    "--stats",
+    statsPath,
+    ...args.extraArgs,
+  ];
+  if (args.trace) {
+    nativeArgs.push("--trace", path.join(projectDir, "trace.json"));
+  }
+
+  const start = process.hrtime.bigint();
+  const result = spawnSync(binary, nativeArgs, { encoding: "utf8", maxBuffer: 64 * 1024 * 1024 });
+  const elapsedMs = Number(process.hrtime.bigint() - start) / 1e6;
+
+  if (result.error) {
+    throw new Error(`failed to run native binary: ${result.error.message}`);
+  }
+  if (result.status !== 0) {
+    process.stderr.write(result.stderr || "");
+    throw new Error(`native exited with code ${result.status}`);
+  }
+
+  return {
+    elapsedMs,
+    peakRssBytes: parsePeakRss(result.stderr || ""),
+    stages: readStageTimes(statsPath),
+  };
+}
+
+function formatMegabytes(bytes) {
+  return bytes === null ? "n/a" : `${(bytes / (1024 * 1024)).toFixed(1)} MiB`;
+}
+
+function main() {
+  const args = parseArgs(process.argv.slice(2));
+  if (args.help) {
+    printHelp();
+    return;
+  }
+
+  const binary = args.binary ? path.resolve(args.binary) : findNativeBinary();
+  if (!binary || !fs.existsSync(binary)) {
+    console.error("[luau-docgen] Native binary not found. Build it first or pass --binary.");
+    process.exit(1);
+  }
+
+  const results = [];
+  for (const size of args.sizes) {
+    const projectDir = path.join(path.resolve(args.workDir), `modules-${size}-seed-${args.seed}`);
+    const project = generateProject({ outDir: projectDir, modules: size, seed: args.seed, force: true });
+
+    let best = null;
+    for (let run = 0; run < args.runs; run += 1) {
+      const sample = runOnce(binary, projectDir, args);
+      if (!best || sample.elapsedMs < best.elapsedMs) {
+        best = sample;
+      }
+    }
+
+    const entry = {
+      modules: project.modules,
+      requires: project.requires,
+      elapsedMs: Math.round(best.elapsedMs),
+      modulesPerSecond: Math.round((project.modules * 1000) / best.elapsedMs),
+      peakRssBytes: best.peakRssBytes,
+      stages: best.stages,
+      tracePath: args.trace ? path.join(projectDir, "trace.json") : null,
+    };
+    results.push(entry);
+
+    console.log(
+      `[luau-docgen] ${String(entry.modules).padStart(6)} modules  ${String(entry.elapsedMs).padStart(8)} ms  ` +
+        `${String(entry.modulesPerSecond).padStart(7)} modules/s  peak ${formatMegabytes(entry.peakRssBytes)}`
+    );
+
+    if (entry.stages) {
+      for (const name of Object.keys(entry.stages)) {
+        console.log(`    ${name.padEnd(24)} ${entry.stages[name].toFixed(1).padStart(10)} ms`);
+      }
+    }
+  }
+
+  if (args.json) {
+    const payload = { binary, seed: args.seed, extraArgs: args.extraArgs, results };
+    fs.writeFileSync(path.resolve(args.json), `${JSON.stringify(payload, null, 2)}\n`, "utf8");
+  }
+}
+
+try {
+  main();
+} catch (error) {
+  console.error(`[luau-docgen] ${error.message}`);
+  process.exit(1);
+}
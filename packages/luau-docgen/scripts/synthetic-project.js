@@ -0,0 +1,329 @@
+#!/usr/bin/env node
+/*
+스케일링 측정용 합성 Luau 프로젝트를 생성하는 스크립트입니다.
+같은 --seed와 --modules면 항상 같은 파일을 만듭니다.
+*/
+const fs = require("fs");
+const path = require("path");
+
+const DEFAULTS = {
+  modules: 100,
+  seed: 1,
+  packages: 0,
+  maxFanOut: 6,
+  // luau-docgen이 .luaurc alias require를 풀지 않으므로 기본으로는 쓰지 않는다.
+  aliasRatio: 0,
+  methods: 4,
+  fields: 5,
+};
+
+function parseArgs(argv) {
+  const args = {
+    ...DEFAULTS,
+    outDir: null,
+    force: false,
+  };
+
+  for (let i = 0; i < argv.length; i += 1) {
+    const arg = argv[i];
+
+    if (arg === "--out" && argv[i + 1]) {
+      args.outDir = argv[i + 1];
+      i += 1;
+      continue;
+    }
+
+    if (arg === "--modules" && argv[i + 1]) {
+      args.modules = Number.parseInt(argv[i + 1], 10);
+      i += 1;
+      continue;
+    }
+
+    if (arg === "--seed" && argv[i + 1]) {
+      args.seed = Number.parseInt(argv[i + 1], 10);
+      i += 1;
+      continue;
+    }
+
+    if (arg === "--packages" && argv[i + 1]) {
+      args.packages = Number.parseInt(argv[i + 1], 10);
+      i += 1;
+      continue;
+    }
+
+    if (arg === "--max-fan-out" && argv[i + 1]) {
+      args.maxFanOut = Number.parseInt(argv[i + 1], 10);
+      i += 1;
+      continue;
+    }
+
+    if (arg === "--alias-ratio" && argv[i + 1]) {
+      args.aliasRatio = Number.parseFloat(argv[i + 1]);
+      i += 1;
+      continue;
+    }
+
+    if (arg === "--force") {
+      args.force = true;
+      continue;
+    }
+
+    if (arg === "-h" || arg === "--help") {
+      args.help = true;
+      continue;
+    }
+  }
+
+  return args;
+}
+
+function printHelp() {
+  console.log("synthetic-project");
+  console.log("\nUsage:");
+  console.log("  node scripts/synthetic-project.js --out <dir> [--modules <n>] [--seed <n>]");
+  console.log("\nOptions:");
+  console.log("  --out <dir>          Output project directory");
+  console.log("  --modules <n>        Number of modules (default: 100)");
+  console.log("  --seed <n>           PRNG seed (default: 1)");
+  console.log("  --packages <n>       Number of src/ subdirectories (default: sqrt(modules))");
+  console.log("  --max-fan-out <n>    Maximum requires per module (default: 6)");
+  console.log("  --alias-ratio <r>    Share of cross-package requires using .luaurc aliases (default: 0; aliases are not resolved by luau-docgen)");
+  console.log("  --force              Remove the output directory first");
+}
+
+// mulberry32: 플랫폼과 Node 버전에 관계없이 같은 수열을 만든다.
+function createRandom(seed) {
+  let state = seed >>> 0;
+  return () => {
+    state = (state + 0x6d2b79f5) >>> 0;
+    let t = state;
+    t = Math.imul(t ^ (t >>> 15), t | 1);
+    t ^= t + Math.imul(t ^ (t >>> 7), t | 61);
+    return ((t ^ (t >>> 14)) >>> 0) / 4294967296;
+  };
+}
+
+function randomInt(random, min, max) {
+  return min + Math.floor(random() * (max - min + 1));
+}
+
+// 앞쪽 모듈일수록 자주 require되도록 치우치게 뽑아 실제 프로젝트의 fan-in 분포를 흉내 낸다.
+function pickDependency(random, index) {
+  const skewed = Math.pow(random(), 2.5);
+  return Math.floor(skewed * index);
+}
+
+const FIELD_TYPES = ["number", "string", "boolean", "string?", "{ string }", "{ [string]: number }"];
+const VERBS = ["get", "set", "update", "compute", "find", "apply", "resolve", "merge"];
+const NOUNS = ["Value", "Entry", "State", "Range", "Handle", "Config", "Snapshot", "Record"];
+
+function buildLayout(options) {
+  const packageCount = options.packages > 0 ? options.packages : Math.max(1, Math.round(Math.sqrt(options.modules)));
+  const modules = [];
+
+  for (let i = 0; i < options.modules; i += 1) {
+    const packageIndex = i % packageCount;
+    modules.push({
+      index: i,
+      name: `Module${i}`,
+      packageName: `pkg${packageIndex}`,
+      alias: `Pkg${packageIndex}`,
+    });
+  }
+
+  return { packageCount, modules };
+}
+
+function requirePathFor(from, to, useAlias) {
+  if (from.packageName === to.packageName) {
+    return `./${to.name}`;
+  }
+
+  if (useAlias) {
+    return `@${to.alias}/${to.name}`;
+  }
+
+  return `../${to.packageName}/${to.name}`;
+}
+
+function renderModule(module, deps, random, options) {
+  const lines = [];
+  const className = module.name;
+  const itemType = `${className}Item`;
+
+  lines.push("--!strict");
+  for (const dep of deps) {
+    lines.push(`local ${dep.module.name} = require("${dep.requirePath}")`);
+  }
+  if (deps.length > 0) {
+    lines.push("");
+  }
+
+  lines.push("--[=[");
+  lines.push(`\t@class ${className}`);
+  lines.push("");
+  lines.push(`\tSynthetic class ${module.index} in ${module.packageName}.`);
+  lines.push("");
+  lines.push("\t```lua");
+  lines.push(`\tlocal value = ${className}.new("example")`);
+  lines.push("\t```");
+  lines.push("]=]");
+  lines.push(`local ${className} = {}`);
+  lines.push(`${className}.__index = ${className}`);
+  lines.push("");
+
+  lines.push(`--- Item stored by ${className}.`);
+  lines.push(`export type ${itemType} = {`);
+  const fieldCount = randomInt(random, 2, options.fields);
+  for (let f = 0; f < fieldCount; f += 1) {
+    const fieldType = FIELD_TYPES[randomInt(random, 0, FIELD_TYPES.length - 1)];
+    const style = randomInt(random, 0, 2);
+    if (style === 0) {
+      lines.push(`\t-- Field ${f} of ${itemType}.`);
+      lines.push(`\tfield${f}: ${fieldType},`);
+    } else if (style === 1) {
+      lines.push(`\t--- Field ${f} of ${itemType}.`);
+      lines.push(`\t--- Continues on a second line.`);
+      lines.push(`\tfield${f}: ${fieldType},`);
+    } else {
+      lines.push(`\tfield${f}: ${fieldType}, -- Trailing doc for field ${f}`);
+    }
+  }
+  for (const dep of deps.slice(0, 2)) {
+    lines.push(`\t-- Linked item from ${dep.module.name}.`);
+    lines.push(`\tlinked${dep.module.name}: ${dep.module.name}.${dep.module.name}Item?,`);
+  }
+  lines.push("}");
+  lines.push("");
+
+  lines.push(`export type ${className} = typeof(setmetatable({} :: { name: string, items: { ${itemType} } }, ${className}))`);
+  lines.push("");
+
+  lines.push("--[=[");
+  lines.push(`\tCreates a new ${className}.`);
+  lines.push("");
+  lines.push("\t@param name string -- Display name");
+  lines.push(`\t@return ${className}`);
+  lines.push("]=]");
+  lines.push(`function ${className}.new(name: string): ${className}`);
+  lines.push(`\treturn setmetatable({ name = name, items = {} }, ${className})`);
+  lines.push("end");
+  lines.push("");
+
+  const methodCount = randomInt(random, 1, options.methods);
+  for (let m = 0; m < methodCount; m += 1) {
+    const methodName = `${VERBS[randomInt(random, 0, VERBS.length - 1)]}${NOUNS[randomInt(random, 0, NOUNS.length - 1)]}${m}`;
+    const dep = deps.length > 0 ? deps[randomInt(random, 0, deps.length - 1)] : null;
+
+    lines.push("--[=[");
+    lines.push(`\t${methodName} on ${className}.`);
+    lines.push("");
+    lines.push("\t@param index number -- Item index");
+    if (dep) {
+      lines.push(`\t@param other ${dep.module.name} -- Related instance`);
+    }
+    lines.push(`\t@return ${itemType}? -- Matching item`);
+    if (m % 3 === 2) {
+      lines.push("\t@yields");
+    }
+    lines.push("]=]");
+    if (dep) {
+      lines.push(`function ${className}:${methodName}(index: number, other: ${dep.module.name}.${dep.module.name}): ${itemType}?`);
+      lines.push(`\tlocal _ = other`);
+    } else {
+      lines.push(`function ${className}:${methodName}(index: number): ${itemType}?`);
+    }
+    lines.push("\treturn self.items[index]");
+    lines.push("end");
+    lines.push("");
+  }
+
+  lines.push(`--- @private`);
+  lines.push(`local function helper(value: number): number`);
+  lines.push(`\treturn value * ${module.index + 1}`);
+  lines.push("end");
+  lines.push(`${className}.helper = helper`);
+  lines.push("");
+  lines.push(`return ${className}`);
+  lines.push("");
+
+  return lines.join("\n");
+}
+
+function renderLuaurc(layout) {
+  const aliases = {};
+  for (let p = 0; p < layout.packageCount; p += 1) {
+    aliases[`Pkg${p}`] = `./src/pkg${p}`;
+  }
+
+  return `${JSON.stringify({ languageMode: "strict", aliases }, null, 2)}\n`;
+}
+
+function generateProject(options) {
+  const settings = { ...DEFAULTS, ...options };
+  if (!settings.outDir) {
+    throw new Error("outDir is required");
+  }
+
+  const outDir = path.resolve(settings.outDir);
+  if (settings.force && fs.existsSync(outDir)) {
+    fs.rmSync(outDir, { recursive: true, force: true });
+  }
+
+  const random = createRandom(settings.seed);
+  const layout = buildLayout(settings);
+  const srcDir = path.join(outDir, "src");
+
+  for (let p = 0; p < layout.packageCount; p += 1) {
+    fs.mkdirSync(path.join(srcDir, `pkg${p}`), { recursive: true });
+  }
+
+  fs.writeFileSync(path.join(outDir, ".luaurc"), renderLuaurc(layout), "utf8");
+
+  let requireCount = 0;
+  for (const module of layout.modules) {
+    const deps = [];
+    const seen = new Set();
+    const fanOut = module.index === 0 ? 0 : randomInt(random, 0, Math.min(settings.maxFanOut, module.index));
+
+    for (let d = 0; d < fanOut; d += 1) {
+      const target = layout.modules[pickDependency(random, module.index)];
+      if (seen.has(target.index)) {
+        continue;
+      }
+      seen.add(target.index);
+
+      const useAlias = random() < settings.aliasRatio;
+      deps.push({ module: target, requirePath: requirePathFor(module, target, useAlias) });
+    }
+
+    requireCount += deps.length;
+    const filePath = path.join(srcDir, module.packageName, `${module.name}.luau`);
+    fs.writeFileSync(filePath, renderModule(module, deps, random, settings), "utf8");
+  }
+
+  return {
+    outDir,
+    srcDir,
+    modules: layout.modules.length,
+    packages: layout.packageCount,
+    requires: requireCount,
+  };
+}
+
+if (require.main === module) {
+  const args = parseArgs(process.argv.slice(2));
+  if (args.help || !args.outDir) {
+    printHelp();
+    process.exit(args.help ? 0 : 1);
+  }
+
+  const result = generateProject(args);
+  console.log(
+    `[luau-docgen] Generated ${result.modules} modules in ${result.packages} packages (${result.requires} requires) -> ${result.outDir}`
+  );
+}
+
+module.exports = {
+  generateProject,
+};
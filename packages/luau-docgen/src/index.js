@@ -1,6 +1,7 @@
 const crypto = require("crypto");
 const fs = require("fs");
 const path = require("path");
+const { loadNativeAddon, createNativeSession } = require("./native-addon");
 
 const SUPPORTED_EXTS = new Set([".luau", ".lua"]);
 const DEFAULT_SCHEMA_VERSION = 1;
@@ -1383,4 +1384,6 @@ function generate(options) {
 
 module.exports = {
   generate,
+  loadNativeAddon,
+  createNativeSession,
 };
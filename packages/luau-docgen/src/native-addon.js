@@ -0,0 +1,114 @@
+const fs = require("fs");
+const path = require("path");
+const pkg = require("../package.json");
+
+const ADDON_NAME = "luau_docgen.node";
+
+let cachedAddon;
+
+function findAddonPath() {
+  const fromEnv = process.env.LUAU_DOCGEN_ADDON_PATH;
+  if (fromEnv && fs.existsSync(fromEnv)) {
+    return fromEnv;
+  }
+
+  const baseDir = path.resolve(__dirname, "..", "native");
+  const candidates = [
+    path.join(baseDir, "bin", ADDON_NAME),
+    path.join(baseDir, "build-addon", "cpp", ADDON_NAME),
+    path.join(baseDir, "build-addon", "cpp", "Release", ADDON_NAME),
+  ];
+
+  for (const candidate of candidates) {
+    if (fs.existsSync(candidate)) {
+      return candidate;
+    }
+  }
+
+  return null;
+}
+
+function loadNativeAddon() {
+  if (cachedAddon !== undefined) {
+    return cachedAddon;
+  }
+
+  cachedAddon = null;
+  if (process.env.LUAU_DOCGEN_DISABLE_ADDON === "1") {
+    return cachedAddon;
+  }
+
+  const addonPath = findAddonPath();
+  if (!addonPath) {
+    return cachedAddon;
+  }
+
+  try {
+    cachedAddon = require(addonPath);
+  } catch (error) {
+    console.warn(`[luau-docgen] failed to load native addon ${addonPath}: ${error.message}`);
+  }
+
+  return cachedAddon;
+}
+
+class NativeDocgenSession {
+  constructor(addon, handle) {
+    this.addon = addon;
+    this.handle = handle;
+  }
+
+  updateFile(filePath, contents) {
+    return this.addon.updateFile(this.handle, filePath, contents);
+  }
+
+  removeFile(filePath) {
+    return this.addon.removeFile(this.handle, filePath);
+  }
+
+  // 출력은 generate.js가 받는 { data, raw } 형태로 돌려준다.
+  generate() {
+    const result = this.addon.generate(this.handle);
+    const raw = Buffer.from(result.output).toString("utf8");
+    return {
+      status: result.status,
+      raw,
+      data: JSON.parse(raw),
+    };
+  }
+
+  close() {
+    this.addon.destroySession(this.handle);
+  }
+}
+
+function createNativeSession(options) {
+  const addon = loadNativeAddon();
+  if (!addon) {
+    return null;
+  }
+
+  const handle = addon.createSession({
+    rootDir: options.rootDir,
+    srcDir: options.srcDir || undefined,
+    typesDir: options.typesDir || undefined,
+    generatorVersion: options.generatorVersion || pkg.version,
+    failOnWarning: options.failOnWarning === true,
+    lazyCheck: options.lazyCheck === true,
+    classLayout: options.classLayout === true,
+    renderDir: options.renderDir || undefined,
+    renderOptions: options.renderOptions || undefined,
+    searchIndexPath: options.searchIndexPath || undefined,
+    schemaVersion: options.schemaVersion === 2 ? 2 : undefined,
+    moduleTimeLimitSec: options.moduleTimeLimitSec,
+    instantiationLimit: options.instantiationLimit,
+    unifierIterationLimit: options.unifierIterationLimit,
+  });
+
+  return new NativeDocgenSession(addon, handle);
+}
+
+module.exports = {
+  loadNativeAddon,
+  createNativeSession,
+};
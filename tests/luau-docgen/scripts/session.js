@@ -0,0 +1,100 @@
+const assert = require("assert");
+const fs = require("fs");
+const os = require("os");
+const path = require("path");
+const { spawnSync } = require("child_process");
+
+const repoRoot = path.resolve(__dirname, "..", "..", "..");
+const testsDir = path.resolve(__dirname, "..");
+const docgenBin = path.join(repoRoot, "packages", "luau-docgen", "bin", "luau-docgen.js");
+const { loadNativeAddon, createNativeSession } = require(path.join(
+  repoRoot,
+  "packages",
+  "luau-docgen",
+  "src",
+  "native-addon.js"
+));
+
+// Node-API 세션에 파일을 바꾸고 빼고 더한 결과가, 같은 디스크 상태로 CLI를 새로 실행한 결과와 같아야 한다.
+function runCli(rootDir) {
+  const outPath = path.join(rootDir, "cli.json");
+  const result = spawnSync(
+    process.execPath,
+    [docgenBin, "--root", rootDir, "--src", "src", "--out", outPath, "--class-layout"],
+    { cwd: rootDir, encoding: "utf8" }
+  );
+  if (result.error) {
+    throw result.error;
+  }
+  if (result.stderr.includes("Native binary not found")) {
+    throw new Error("native luau-docgen binary not found; run `npm --prefix packages/luau-docgen run native:build` first");
+  }
+  assert.ok(fs.existsSync(outPath), `no CLI output (exit ${result.status}): ${result.stderr}`);
+  return JSON.parse(fs.readFileSync(outPath, "utf8"));
+}
+
+function assertSameAsCli(session, rootDir, label) {
+  const result = session.generate();
+  assert.strictEqual(result.status, 0, `${label}: session status ${result.status}`);
+  assert.deepStrictEqual(result.data.modules, runCli(rootDir).modules, `${label}: session output differs from CLI`);
+  return result.data;
+}
+
+function findModule(data, id) {
+  return data.modules.find((module) => module.id === id);
+}
+
+function run(rootDir) {
+  const srcDir = path.join(rootDir, "src");
+  fs.cpSync(path.join(testsDir, "fixtures", "bounded", "src"), srcDir, { recursive: true });
+
+  const session = createNativeSession({ rootDir, srcDir: "src", classLayout: true });
+  try {
+    const base = assertSameAsCli(session, rootDir, "initial");
+
+    // Shapes가 바뀌면 Shapes 타입을 보여 주는 Geometry와 Canvas도 다시 검사해야 한다.
+    const shapesPath = path.join(srcDir, "Shapes.luau");
+    const shapes = fs.readFileSync(shapesPath, "utf8");
+    const changedShapes = shapes.replace("{ x: number, y: number }", "{ x: number, y: number, z: number }");
+    assert.notStrictEqual(changedShapes, shapes);
+    fs.writeFileSync(shapesPath, changedShapes);
+    assert.strictEqual(session.updateFile(shapesPath, changedShapes), 0);
+    assertSameAsCli(session, rootDir, "update");
+
+    // 빠진 모듈을 require하던 모듈은 다시 검사하고, 상관없는 모듈은 그대로다.
+    fs.writeFileSync(shapesPath, shapes);
+    assert.strictEqual(session.updateFile(shapesPath, shapes), 0);
+    fs.rmSync(shapesPath);
+    assert.strictEqual(session.removeFile(shapesPath), 0);
+    const removed = assertSameAsCli(session, rootDir, "remove");
+    assert.ok(!findModule(removed, "Shapes"), "removed module still in output");
+
+    assert.notStrictEqual(session.removeFile(path.join(srcDir, "Missing.luau")), 0, "removing an unknown file succeeded");
+
+    // 다시 더하면 실패했던 require가 풀려야 한다.
+    fs.writeFileSync(shapesPath, shapes);
+    assert.strictEqual(session.updateFile(shapesPath, shapes), 0);
+    assert.deepStrictEqual(assertSameAsCli(session, rootDir, "add").modules, base.modules);
+  } finally {
+    session.close();
+  }
+
+  // 검사 예산도 세션까지 전달되어야 한다. 음수는 세션 생성에서 거부된다.
+  assert.throws(() => createNativeSession({ rootDir, srcDir: "src", instantiationLimit: -1 }));
+}
+
+if (!loadNativeAddon()) {
+  console.error("[test] luau-docgen addon not found; run `npm --prefix packages/luau-docgen run native:addon` first");
+  process.exit(1);
+}
+
+const rootDir = fs.mkdtempSync(path.join(os.tmpdir(), "luau-docgen-session-"));
+try {
+  run(rootDir);
+  console.log("[test] luau-docgen session: ok");
+} catch (error) {
+  console.error(`[test] luau-docgen session: ${error.message}`);
+  process.exitCode = 1;
+} finally {
+  fs.rmSync(rootDir, { recursive: true, force: true });
+}
@@ -0,0 +1,490 @@
+const assert = require("assert");
+const fs = require("fs");
+const os = require("os");
+const path = require("path");
+const { spawnSync } = require("child_process");
+
+const repoRoot = path.resolve(__dirname, "..", "..", "..");
+const testsDir = path.resolve(__dirname, "..");
+const docgenBin = path.join(repoRoot, "packages", "luau-docgen", "bin", "luau-docgen.js");
+const {
+  expandReferenceJson,
+  normalizeOptions,
+  buildNativeRenderOptions,
+  buildOutputs,
+  collectNativeOutputs,
+} = require(path.join(repoRoot, "packages", "docusaurus-plugin-reference", "generate.js"));
+const { buildDocgenArgs } = require(path.join(repoRoot, "packages", "bakerywave", "src", "docgen-args.js"));
+
+// 각 케이스는 fixtures/<fixture>/src를 네이티브 luau-docgen으로 생성한다.
+// - expected: expected/<name>.json과 같아야 한다.
+// - variants: 옵션을 더해도 기본 실행과 같은 reference.json이 나와야 한다.
+// - 모든 픽스처는 --schema-version 2 출력을 expandReferenceJson으로 펼치면 기본 실행(v1)과 같아야 한다.
+// - check: 출력 JSON과 stderr를 받아 케이스별로 확인한다.
+// - run: 기본 실행 대신 케이스가 직접 docgen을 실행해 확인한다(여러 패키지처럼 인자가 다른 경우).
+const cases = [
+  {
+    name: "basic",
+    fixture: "basic",
+    expected: "basic.json",
+  },
+  {
+    // Canvas는 Geometry만 require하지만 타입은 Shapes 아레나를 가리킨다.
+    // Shapes를 Canvas 추출 전에 해제하면 출력이 달라지거나 잘못된 메모리를 읽는다.
+    name: "bounded-memory",
+    fixture: "bounded",
+    check({ data }) {
+      assert.ok(findSymbol(data, "Canvas.origin").types.display);
+      assert.ok(findSymbol(data, "Canvas.makePoint").types.display);
+    },
+    variants: [
+      {
+        args: ["--bounded-memory", "--verbose"],
+        check({ stderr }) {
+          const match = stderr.match(/bounded memory: peak (\d+) live module\(s\) of (\d+)/);
+          assert.ok(match, "missing bounded memory stats");
+          // Shapes, Geometry, Canvas는 Canvas를 추출할 때까지 같이 살아 있어야 한다.
+          assert.ok(Number(match[1]) >= 3, `peak ${match[1]} live modules`);
+          assert.strictEqual(Number(match[2]), 4);
+        },
+      },
+    ],
+  },
+  {
+    // 어떤 검사도 1ns 안에 끝나지 않으므로 모든 모듈이 시간 예산을 넘기고 구문 기반 타입으로 돌아간다.
+    name: "module-time-limit",
+    fixture: "bounded",
+    args: ["--module-time-limit", "0.000000001"],
+    check({ data, stderr }) {
+      for (const name of ["Shapes", "Geometry", "Canvas", "Standalone"]) {
+        assert.match(stderr, new RegExp(`module '${name}' exceeded the time limit`));
+      }
+      const checked = runSeparately("bounded", []);
+      assert.notDeepStrictEqual(findSymbol(data, "Canvas.origin").types, findSymbol(checked, "Canvas.origin").types);
+    },
+    variants: [{ args: ["--bounded-memory"] }],
+  },
+  {
+    // Util은 주석만으로 타입이 다 나오고 Main만 검사가 필요하다. Main을 검사하면 Util도 같이 검사된다.
+    name: "lazy-check",
+    fixture: "lazy",
+    check({ stderr }) {
+      assert.ok(!stderr.includes("lazy check"), "lazy check stats printed without --lazy-check");
+    },
+    variants: [
+      {
+        args: ["--lazy-check"],
+        check({ stderr }) {
+          assert.ok(!stderr.includes("lazy check"), "lazy check stats printed without --verbose");
+        },
+      },
+      {
+        args: ["--lazy-check", "--verbose"],
+        check({ stderr }) {
+          assert.match(stderr, /lazy check: skipped 1 of 2 module type checks/);
+        },
+      },
+      {
+        // 계획에서 빠졌지만 Main 때문에 검사된 Util도 살아 있는 모듈로 세고 해제해야 한다.
+        args: ["--lazy-check", "--bounded-memory", "--verbose"],
+        check({ stderr }) {
+          assert.match(stderr, /bounded memory: peak 2 live module\(s\) of 2/);
+        },
+      },
+    ],
+  },
+  {
+    // types/Host.luau는 정의 파일로 전역에 올라가고, Main은 그 전역으로 반환 타입을 얻는다.
+    // Bridge의 require("./Host")는 정의 파일을 일반 모듈로 검사하지 않아야 한다.
+    name: "definitions",
+    fixture: "definitions",
+    args: ["--types", path.join("tests", "luau-docgen", "fixtures", "definitions", "types")],
+    check({ data }) {
+      assert.strictEqual(findSymbol(data, "Main.hello").types.structured.returns[0].type, "string");
+      assert.ok(findSymbol(data, "Host.greet"));
+      assert.ok(findSymbol(data, "Bridge.host"));
+    },
+    variants: [{ args: ["--lazy-check"] }, { args: ["--bounded-memory"] }],
+  },
+  {
+    // 타입 테이블 필드 문서는 필드 바로 위 주석 묶음에서만 가져온다.
+    // "---" 줄 묶음, 빈 줄 너머의 주석, 블록 주석, 블록 주석 뒤에 붙은 "---" 줄, 앞 필드 바로 뒤 필드를 확인한다.
+    name: "inline-fields",
+    fixture: "inline-fields",
+    check({ data }) {
+      const description = (name) => findSymbol(data, `Config.${name}`).docs.descriptionMarkdown;
+      assert.strictEqual(findSymbol(data, "Config").kind, "type");
+      assert.strictEqual(description("plain"), "");
+      assert.strictEqual(description("name"), "The display name.");
+      assert.strictEqual(description("retries"), "How many times to retry.\nZero disables retries.");
+      assert.strictEqual(description("timeout").trim(), "Seconds before giving up.");
+      assert.strictEqual(description("mixed"), "Dash part.");
+      assert.strictEqual(description("after"), "");
+    },
+  },
+  {
+    // 기본 실행은 출력을 스트리밍한다. Base와 Derived는 어느 순서로 읽혀도 한꺼번에 쓸 때와 같아야 한다.
+    name: "stream-inherit-doc",
+    fixture: "stream-inherit",
+    check({ data, outPath }) {
+      const base = findSymbol(data, "Base.describe");
+      assert.ok(base.docs.descriptionMarkdown);
+      assert.strictEqual(findSymbol(data, "Derived.describe").docs.descriptionMarkdown, base.docs.descriptionMarkdown);
+      assert.deepStrictEqual(data.modules, collectAll("stream-inherit").modules);
+      assert.ok(!fs.existsSync(`${outPath}.tmp`), "streamed output left its temp file");
+    },
+    variants: [
+      {
+        args: ["--verbose"],
+        check({ stderr }) {
+          assert.match(stderr, /streamed output: peak \d+ held module\(s\)/);
+        },
+      },
+    ],
+  },
+  {
+    // 어느 모듈에도 없는 @inheritDoc 대상을 기다리며 모듈을 붙잡아 두면 안 된다.
+    name: "stream-missing-target",
+    fixture: "stream-missing",
+    check({ data }) {
+      assert.strictEqual(findSymbol(data, "Orphan.run").docs.descriptionMarkdown, "Runs without an inherited description.");
+      assert.deepStrictEqual(data.modules, collectAll("stream-missing").modules);
+    },
+    variants: [
+      {
+        args: ["--verbose"],
+        check({ stderr }) {
+          assert.match(stderr, /streamed output: peak 1 held module\(s\)/);
+        },
+      },
+    ],
+  },
+  {
+    // 클래스 레이아웃도 스트리밍 출력에서 계산한다. Button.clicked는 뒤에 쓰는 Widget.changed의 @tag event를 상속하므로
+    // 상속을 적용한 뒤의 태그로 섹션을 정해야 한다.
+    name: "stream-class-layout",
+    fixture: "stream-layout",
+    args: ["--class-layout"],
+    check({ data }) {
+      const button = data.classes.find((entry) => entry.name === "Button");
+      const events = button.layout.sections.find((section) => section.kind === "event");
+      assert.ok(events, "Button.clicked is not in the event section");
+      const clicked = events.members.map((member) => data.modules[member.module].symbols[member.symbol].qualifiedName);
+      assert.deepStrictEqual(clicked, ["Button.clicked"]);
+      assert.deepStrictEqual(data.classOrder.map((index) => data.classes[index].name), ["Button", "Widget"]);
+      assert.deepStrictEqual(data, collectAll("stream-layout", ["--class-layout"]));
+    },
+    variants: [
+      {
+        // Button은 Widget이 나올 때까지 붙잡아 둔다.
+        args: ["--verbose"],
+        check({ stderr }) {
+          assert.match(stderr, /streamed output: peak 2 held module\(s\)/);
+        },
+      },
+    ],
+  },
+  {
+    // bakerywave reference build가 넘기는 인자 그대로 실행해도 출력을 스트리밍해야 한다.
+    name: "bakerywave-args",
+    run(outDir) {
+      const input = path.join(outDir, "reference.json");
+      const defaults = {
+        lang: "luau",
+        rootDir: repoRoot,
+        srcDir: path.join("tests", "luau-docgen", "fixtures", "stream-layout", "src"),
+        typesDir: null,
+        input,
+        schemaVersion: 1,
+        limits: {},
+        render: null,
+      };
+      const result = spawnDocgen([...buildDocgenArgs(defaults, { failOnWarning: false, legacy: false }), "--verbose"]);
+      const data = readOutput(input, result);
+      assert.match(result.stderr, /streamed output: peak \d+ held module\(s\)/);
+      assert.deepStrictEqual(data, collectAll("stream-layout", ["--class-layout"]));
+    },
+  },
+  {
+    // --render-mdx로 쓴 페이지는 generate.js가 일반 출력으로 렌더링한 페이지와 바이트 단위로 같아야 한다.
+    name: "render-mdx",
+    run(outDir) {
+      for (const fixture of ["basic", "bounded", "lazy", "stream-inherit", "inline-fields"]) {
+        const { data, options } = renderNative(fixture, outDir);
+        assert.ok(data.mdx, `${fixture}: no mdx marker`);
+        assert.ok(collectNativeOutputs(data, options), `${fixture}: generate.js does not reuse the native pages`);
+        comparePages(fixture, options.outDir, buildOutputs(runDocgen(fixture, [], outDir).data, options));
+
+        // 렌더 옵션이 바뀌면 해시가 달라 generate.js가 다시 렌더링한다.
+        const changed = renderOptionsFor(outDir, fixture, { overviewTitle: "Changed" });
+        assert.strictEqual(collectNativeOutputs(data, changed), null, `${fixture}: options hash mismatch ignored`);
+      }
+
+      // 정렬 키가 ASCII가 아니면 레이아웃과 표시를 남기지 않아 generate.js가 렌더링한다.
+      const { data, options } = renderNative("render-unicode", outDir);
+      assert.strictEqual(data.mdx, undefined, "mdx marker written for a non-ASCII class name");
+      assert.strictEqual(data.classOrder, undefined, "class layout written for a non-ASCII class name");
+      assert.strictEqual(collectNativeOutputs(data, options), null);
+      assert.ok(buildOutputs(data, options).some((output) => output.id === "Élan"));
+    },
+  },
+  {
+    // 색인의 페이지와 앵커는 같은 실행에서 렌더링한 페이지를 가리켜야 한다.
+    name: "search-index",
+    run(outDir) {
+      for (const fixture of ["basic", "bounded", "stream-inherit", "stream-layout"]) {
+        const indexPath = path.join(outDir, `${fixture}.search.json`);
+        const { data, options } = renderNative(fixture, outDir, ["--search-index", indexPath]);
+        const search = JSON.parse(fs.readFileSync(indexPath, "utf8"));
+        assert.strictEqual(search.pages.length, data.classOrder.length, `${fixture}: page count`);
+
+        const documentsByPage = search.pages.map(() => []);
+        for (const document of search.documents) {
+          assert.ok(documentsByPage[document[0]], `${fixture}: document points at page ${document[0]}`);
+          documentsByPage[document[0]].push(document);
+        }
+
+        data.classOrder.forEach((classIndex, page) => {
+          const entry = data.classes[classIndex];
+          assert.deepStrictEqual(search.pages[page], { link: entry.layout.link, title: entry.name });
+
+          const content = fs.readFileSync(path.join(options.outDir, entry.layout.path), "utf8");
+          const [classDocument, ...memberDocuments] = documentsByPage[page];
+          assert.strictEqual(classDocument[1], null, `${fixture}: ${entry.name} class entry has an anchor`);
+
+          const members = entry.layout.sections.flatMap((section) => section.members);
+          assert.deepStrictEqual(
+            memberDocuments.map((document) => document[1]),
+            members.map((member) => member.anchor),
+            `${fixture}: ${entry.name} anchors differ from the layout`
+          );
+          members.forEach((member, index) => {
+            const symbol = data.modules[member.module].symbols[member.symbol];
+            const document = memberDocuments[index];
+            assert.strictEqual(document[3], symbol.qualifiedName || symbol.name);
+            assert.strictEqual(document[4], symbol.summary || "");
+            assert.ok(
+              content.includes(` {#${document[1]}}\n`),
+              `${fixture}: ${entry.layout.path} has no heading for #${document[1]}`
+            );
+          });
+        });
+      }
+
+      // 레이아웃을 generate.js가 계산하면 색인을 쓰지 않고 이전 색인도 지운다.
+      const indexPath = path.join(outDir, "render-unicode.search.json");
+      fs.writeFileSync(indexPath, "{}");
+      renderNative("render-unicode", outDir, ["--search-index", indexPath]);
+      assert.ok(!fs.existsSync(indexPath), "search index written for a non-ASCII class name");
+    },
+  },
+  {
+    // 패키지 하나(strict/pkg) 위에만 .luaurc가 있다. 여러 패키지를 같이 생성해도 패키지마다 따로 실행한 결과와 같아야 한다.
+    name: "multi-root",
+    run(outDir) {
+      const fixtureDir = path.join("tests", "luau-docgen", "fixtures", "multiroot");
+      const roots = [path.join(fixtureDir, "strict", "pkg"), path.join(fixtureDir, "plain")];
+      const standalone = roots.map((root, index) => {
+        const outPath = path.join(outDir, `standalone-${index}.json`);
+        const result = spawnDocgen(["--root", root, "--out", outPath]);
+        return readOutput(outPath, result);
+      });
+
+      const packageArgs = [];
+      const outPaths = roots.map((root, index) => path.join(outDir, `multi-${index}.json`));
+      roots.forEach((root, index) => {
+        packageArgs.push(index === 0 ? "--root" : "--package", root, "--out", outPaths[index]);
+      });
+      const result = spawnDocgen(packageArgs);
+      outPaths.forEach((outPath, index) => {
+        assert.deepStrictEqual(
+          readOutput(outPath, result).modules,
+          standalone[index].modules,
+          `multi-root output differs for ${roots[index]}`
+        );
+      });
+    },
+  },
+];
+
+function spawnDocgen(args) {
+  const result = spawnSync(process.execPath, [docgenBin, ...args], { cwd: repoRoot, encoding: "utf8" });
+  if (result.error) {
+    throw result.error;
+  }
+  if (result.stderr.includes("Native binary not found")) {
+    throw new Error("native luau-docgen binary not found; run `npm --prefix packages/luau-docgen run native:build` first");
+  }
+  return result;
+}
+
+function readOutput(outPath, result) {
+  assert.ok(fs.existsSync(outPath), `no output ${outPath} (exit ${result.status}): ${result.stderr}`);
+  return JSON.parse(fs.readFileSync(outPath, "utf8"));
+}
+
+function runDocgen(fixture, extraArgs, outDir) {
+  const outPath = path.join(outDir, "reference.json");
+  const result = spawnDocgen([
+    "--root",
+    repoRoot,
+    "--src",
+    path.join("tests", "luau-docgen", "fixtures", fixture, "src"),
+    "--out",
+    outPath,
+    ...extraArgs,
+  ]);
+
+  return {
+    status: result.status,
+    stderr: result.stderr,
+    outPath,
+    data: fs.existsSync(outPath) ? JSON.parse(fs.readFileSync(outPath, "utf8")) : null,
+  };
+}
+
+// 스트리밍 출력과 비교할 때처럼 다른 옵션으로 한 번 더 생성한다.
+// 스트리밍하지 않는 실행(schema v2는 모든 모듈을 모아 문자열 표를 만든다)을 v1으로 펼친다.
+function collectAll(fixture, args = []) {
+  return expandReferenceJson(runSeparately(fixture, [...args, "--schema-version", "2"]));
+}
+
+function runSeparately(fixture, args) {
+  const outDir = fs.mkdtempSync(path.join(os.tmpdir(), `luau-docgen-${fixture}-`));
+  try {
+    const result = runDocgen(fixture, args, outDir);
+    assert.ok(result.data, `no output for ${args.join(" ")} (exit ${result.status}): ${result.stderr}`);
+    return result.data;
+  } finally {
+    fs.rmSync(outDir, { recursive: true, force: true });
+  }
+}
+
+function renderOptionsFor(outDir, fixture, overrides = {}) {
+  return normalizeOptions(outDir, {
+    renderer: "native",
+    outDir: path.join(outDir, `mdx-${fixture}`),
+    categoryOrder: [],
+    source: { repoUrl: "https://example.com/repo", branch: "main", basePath: "", stripPrefix: "", icon: "" },
+    ...overrides,
+  });
+}
+
+// bakerywave처럼 buildNativeRenderOptions의 JSON을 파일로 넘겨 네이티브로 렌더링한다.
+function renderNative(fixture, outDir, extraArgs = []) {
+  const options = renderOptionsFor(outDir, fixture);
+  const renderOptionsPath = path.join(outDir, `${fixture}.render.json`);
+  fs.writeFileSync(renderOptionsPath, JSON.stringify(buildNativeRenderOptions(options)));
+  const result = runDocgen(
+    fixture,
+    ["--render-mdx", options.outDir, "--render-options", renderOptionsPath, ...extraArgs],
+    outDir
+  );
+  assert.ok(result.data, `${fixture}: no output with --render-mdx (exit ${result.status}): ${result.stderr}`);
+  return { data: expandReferenceJson(result.data), options };
+}
+
+function listPages(dir, prefix = "") {
+  const pages = [];
+  for (const entry of fs.readdirSync(dir, { withFileTypes: true })) {
+    const relativePath = prefix ? `${prefix}/${entry.name}` : entry.name;
+    if (entry.isDirectory()) {
+      pages.push(...listPages(path.join(dir, entry.name), relativePath));
+    } else if (entry.name.endsWith(".mdx")) {
+      pages.push(relativePath);
+    }
+  }
+  return pages.sort();
+}
+
+// 첫 번째로 다른 페이지와 줄에서 멈춘다.
+function comparePages(fixture, nativeDir, outputs) {
+  const expected = outputs.map((output) => output.relativePath.replace(/\\/g, "/")).sort();
+  assert.deepStrictEqual(listPages(nativeDir), expected, `${fixture}: native page list differs`);
+
+  for (const output of outputs) {
+    const actual = fs.readFileSync(path.join(nativeDir, output.relativePath), "utf8");
+    if (actual === output.content) {
+      continue;
+    }
+    const actualLines = actual.split("\n");
+    const expectedLines = output.content.split("\n");
+    const line = actualLines.findIndex((value, index) => value !== expectedLines[index]);
+    const at = line === -1 ? expectedLines.length : line;
+    assert.fail(
+      `${fixture}: ${output.relativePath} differs at line ${at + 1}\n` +
+        `  native: ${JSON.stringify(actualLines[at])}\n  js:     ${JSON.stringify(expectedLines[at])}`
+    );
+  }
+}
+
+function findSymbol(data, qualifiedName) {
+  for (const module of data.modules) {
+    const symbol = module.symbols.find((entry) => entry.qualifiedName === qualifiedName);
+    if (symbol) {
+      return symbol;
+    }
+  }
+  assert.fail(`symbol not found: ${qualifiedName}`);
+}
+
+function runCase(testCase) {
+  const outDir = fs.mkdtempSync(path.join(os.tmpdir(), `luau-docgen-${testCase.name}-`));
+  try {
+    if (testCase.run) {
+      testCase.run(outDir);
+      return;
+    }
+
+    const base = runDocgen(testCase.fixture, testCase.args || [], outDir);
+    assert.ok(base.data, `no output (exit ${base.status}): ${base.stderr}`);
+
+    if (testCase.expected) {
+      const expected = JSON.parse(fs.readFileSync(path.join(testsDir, "expected", testCase.expected), "utf8"));
+      assert.deepStrictEqual(base.data, expected);
+    }
+
+    if (testCase.check) {
+      testCase.check(base);
+    }
+
+    const compact = runDocgen(testCase.fixture, [...(testCase.args || []), "--schema-version", "2"], outDir);
+    assert.ok(compact.data, `no schema v2 output (exit ${compact.status}): ${compact.stderr}`);
+    assert.strictEqual(compact.data.schemaVersion, 2);
+    assert.deepStrictEqual(expandReferenceJson(compact.data), base.data, "schema v2 does not expand to the v1 output");
+
+    for (const variant of testCase.variants || []) {
+      const result = runDocgen(testCase.fixture, [...(testCase.args || []), ...variant.args], outDir);
+      assert.ok(result.data, `no output for ${variant.args.join(" ")} (exit ${result.status}): ${result.stderr}`);
+      assert.deepStrictEqual(result.data, base.data, `output differs with ${variant.args.join(" ")}`);
+      if (variant.check) {
+        variant.check(result);
+      }
+    }
+  } finally {
+    fs.rmSync(outDir, { recursive: true, force: true });
+  }
+}
+
+const filter = process.argv[2];
+let hasError = false;
+
+for (const testCase of cases) {
+  if (filter && !testCase.name.includes(filter)) {
+    continue;
+  }
+
+  try {
+    runCase(testCase);
+    console.log(`[test] ${testCase.name}: ok`);
+  } catch (error) {
+    hasError = true;
+    console.error(`[test] ${testCase.name}: ${error.message}`);
+  }
+}
+
+if (hasError) {
+  process.exit(1);
+}
+
+console.log("[test] luau-docgen fixtures verified.");